@@ -1,8 +1,8 @@
 import { PixelData } from "./components/canvas/Canvas";
 import { appState, CustomDataOptions } from "./state/appState";
-import { convertHexTo16Bit } from "./utils/color";
-import { waitFor } from "./utils/utils";
-import { getSocket } from "./Websocket";
+import { convertHexTo16Bit, convertHexTo565 } from "./utils/color";
+import { DELTA_APPLIED, DELTA_DROPPED, encodePixelDeltas } from "./utils/pixelDelta";
+import { getSocket, IncommingMessageType } from "./Websocket";
 
 const socket = getSocket();
 
@@ -28,21 +28,23 @@ export const setTextAction = () => {
 	socket.send(msg);
 };
 
-// Not really an action at the moment. Might be a todo for later...
-// For now just send state as separate actions and add a bit of delay in between
-export const syncFullStateAction = async (pixelData: PixelData[]) => {
-	setTextAction();
-	await waitFor(100);
-
-	setCustomDataAction(appState.customData);
-	await waitFor(100);
-
-	setCompositionModeAction(appState.settings.compositionMode);
-	await waitFor(100);
-
-	setBrightnessAction(appState.settings.brightness);
-	await waitFor(100);
+// Restores a saved layout in one round trip: the device holds the scene back until the image
+// that follows it has arrived, then applies text, settings and image in the same frame with a
+// single config write.
+export const syncFullStateAction = (pixelData: PixelData[]) => {
+	const msg = {
+		action: "applyScene",
+		image: true,
+		text: appState.text.map((t) => ({
+			...t,
+			color: convertHexTo16Bit(t.color),
+		})),
+		customData: appState.customData,
+		compositionMode: appState.settings.compositionMode,
+		brightness: appState.settings.brightness,
+	};
 
+	socket.send(msg);
 	drawImageAction(pixelData);
 };
 
@@ -57,45 +59,146 @@ export const setCustomDataAction = (options: CustomDataOptions) => {
 	socket.send(msg);
 };
 
-export const drawPixelAction = async (pixelData: PixelData[], chunkSize = 25): Promise<void> => {
-	appState.connection.isSending = true;
+// Pixel deltas are pipelined: up to MAX_DELTAS_IN_FLIGHT batches wait for their ack at once
+// instead of sleeping between chunks. A batch whose ack never arrives (e.g. the connection
+// dropped) frees its slot after DELTA_ACK_TIMEOUT. A batch the matrix dropped because it was
+// busy is sent again after DELTA_RETRY_DELAY, up to DELTA_MAX_RETRIES times.
+const MAX_DELTAS_IN_FLIGHT = 4;
+const DELTA_ACK_TIMEOUT = 1000;
+const DELTA_RETRY_DELAY = 50;
+const DELTA_MAX_RETRIES = 5;
+
+interface DeltaInFlight {
+	message: ArrayBuffer;
+	timer: ReturnType<typeof setTimeout>;
+	retries: number;
+}
+
+let nextDeltaSeq = 0;
+const deltasInFlight = new Map<number, DeltaInFlight>();
+let deltaSlotWaiters: (() => void)[] = [];
+let pendingDraws = Promise.resolve();
+let pendingDrawCount = 0;
+
+const releaseDelta = (seq: number) => {
+	if (!deltasInFlight.has(seq)) {
+		return;
+	}
 
-	for (let i = 0; i < pixelData.length; i += chunkSize) {
-		sendPixels(pixelData.slice(i, i + chunkSize));
-		await waitFor(50);
+	clearTimeout(deltasInFlight.get(seq).timer);
+	deltasInFlight.delete(seq);
+	deltaSlotWaiters.shift()?.();
+};
+
+const sendDelta = (seq: number, delta: DeltaInFlight) => {
+	clearTimeout(delta.timer);
+	delta.timer = setTimeout(() => releaseDelta(seq), DELTA_ACK_TIMEOUT);
+	socket.sendBinary(delta.message);
+};
+
+const handleDeltaAck = ({ seq, status }: { seq: number; status: number }) => {
+	const delta = deltasInFlight.get(seq);
+	if (delta === undefined) {
+		return;
 	}
 
-	appState.connection.isSending = false;
+	if (status === DELTA_DROPPED && delta.retries < DELTA_MAX_RETRIES) {
+		// Keeps its slot, so the batches after it can't run further ahead
+		delta.retries++;
+		clearTimeout(delta.timer);
+		delta.timer = setTimeout(() => sendDelta(seq, delta), DELTA_RETRY_DELAY);
+		return;
+	}
 
-	return Promise.resolve();
+	if (status !== DELTA_APPLIED) {
+		console.warn("Pixel batch was not applied", seq, status);
+	}
+	releaseDelta(seq);
 };
 
-export const drawImageAction = (pixelData: PixelData[]) => {
-	const mappedPixelData = pixelData.map((d) => convertHexTo16Bit(d.c));
-	const smallImage = mappedPixelData.filter((d, i) => i < 64 * 200);
+socket.subscribe(IncommingMessageType.DeltaAck, handleDeltaAck);
 
-	const msg = {
-		action: "drawImage",
-		data: smallImage,
-	};
+const waitForDeltaSlot = (): Promise<void> =>
+	deltasInFlight.size < MAX_DELTAS_IN_FLIGHT
+		? Promise.resolve()
+		: new Promise((resolve) => deltaSlotWaiters.push(resolve));
 
-	socket.send(msg);
+const sendPixelDeltas = async (pixelData: PixelData[], layer: number) => {
+	const messages = encodePixelDeltas(pixelData, appState.settings.width, layer, () => {
+		nextDeltaSeq = (nextDeltaSeq + 1) & 0xffff;
+		return nextDeltaSeq;
+	});
+
+	for (const message of messages) {
+		await waitForDeltaSlot();
+
+		const seq = new DataView(message).getUint16(2, true);
+		const delta: DeltaInFlight = { message, timer: undefined, retries: 0 };
+		deltasInFlight.set(seq, delta);
+		sendDelta(seq, delta);
+	}
 };
 
-const sendPixels = (pixelData: PixelData[]) => {
-	const mappedPixelData = pixelData.map((d) => ({ p: d.p, c: convertHexTo16Bit(d.c) }));
+// Sends pixels as binary span batches. Calls are queued, so strokes reach the matrix in order.
+export const drawPixelAction = (pixelData: PixelData[], layer = 0): Promise<void> => {
+	appState.connection.isSending = true;
+	pendingDrawCount++;
 
-	const msg = {
-		action: "drawpixel",
-		data: mappedPixelData,
-	};
+	pendingDraws = pendingDraws
+		.then(() => sendPixelDeltas(pixelData, layer))
+		.catch((error) => console.error("Sending pixels failed", error))
+		.finally(() => {
+			pendingDrawCount--;
+			appState.connection.isSending = pendingDrawCount > 0;
+		});
 
-	socket.send(msg);
+	return pendingDraws;
+};
+
+// Binary message opcodes, see esp32/src/websocket/BinaryProtocol.h
+const OP_BLIT_RGB565 = 0x01;
+const BLIT_HEADER_SIZE = 10;
+
+// Uploads a rectangle of raw RGB565 pixels (row by row) into a layer, 2 bytes per pixel
+export const blitAction = (
+	pixels: number[],
+	x: number,
+	y: number,
+	width: number,
+	height: number,
+	layer = 0
+) => {
+	const buffer = new ArrayBuffer(BLIT_HEADER_SIZE + width * height * 2);
+	const view = new DataView(buffer);
+
+	view.setUint8(0, OP_BLIT_RGB565);
+	view.setUint8(1, layer);
+	view.setUint16(2, x, true);
+	view.setUint16(4, y, true);
+	view.setUint16(6, width, true);
+	view.setUint16(8, height, true);
+
+	for (let i = 0; i < width * height; i++) {
+		view.setUint16(BLIT_HEADER_SIZE + i * 2, pixels[i] ?? 0, true);
+	}
+
+	socket.sendBinary(buffer);
+};
+
+export const drawImageAction = (pixelData: PixelData[]) => {
+	const { width, height } = appState.settings;
+	const pixels = pixelData.slice(0, width * height).map((d) => convertHexTo565(d.c));
+
+	blitAction(pixels, 0, 0, width, height);
 };
 
 export const getPixelsAction = () => {
+	// Answered with binary, run-length encoded RGB565 rows of the background layer
 	const msg = {
 		action: "getPixels",
+		layer: 0,
+		format: "rgb565",
+		rle: true,
 	};
 
 	socket.send(msg);
@@ -1,5 +1,7 @@
 import { getPixelsAction, getStateAction } from "./Actions";
 import { appState } from "./state/appState";
+import { decodeDeltaAck, OP_DELTA_ACK } from "./utils/pixelDelta";
+import { decodePixelMessage, OP_PIXELS } from "./utils/pixelReadback";
 
 const ip = (window as any).websocketUrl;
 const gateway = `ws://${ip}/ws`;
@@ -13,6 +15,7 @@ export enum IncommingMessageType {
   MatrixPixelResponse = "matrixPixels",
   MatrixSettingsResponse = "matrixSettings",
   UpdateProgress = "updateProgress",
+  DeltaAck = "deltaAck",
 }
 
 interface MessageListenerMap {
@@ -24,6 +27,7 @@ class WebsocketConnection {
   private messageListeners: MessageListenerMap = {};
 
   constructor() {
+    this.websocket.binaryType = "arraybuffer";
     this.websocket.onopen = this.onOpen;
     this.websocket.onclose = this.onClose;
     this.websocket.onmessage = this.onMessage;
@@ -44,15 +48,33 @@ class WebsocketConnection {
   };
 
   private readonly onMessage = (event: MessageEvent) => {
-    const data = JSON.parse(event.data);
+    const data =
+      event.data instanceof ArrayBuffer
+        ? this.decodeBinary(event.data)
+        : JSON.parse(event.data);
 
     console.log("Incomming message", data);
 
-    if (this.messageListeners[data.action]) {
+    if (data && this.messageListeners[data.action]) {
       this.messageListeners[data.action].forEach((listener) => listener(data));
     }
   };
 
+  // Binary messages are decoded into the same shape as their JSON counterparts
+  private decodeBinary(buffer: ArrayBuffer): Message | null {
+    const opcode = new Uint8Array(buffer)[0];
+
+    switch (opcode) {
+      case OP_PIXELS:
+        return decodePixelMessage(buffer);
+      case OP_DELTA_ACK:
+        return decodeDeltaAck(buffer);
+      default:
+        console.warn("Unknown binary message", opcode);
+        return null;
+    }
+  }
+
   public subscribe(action: IncommingMessageType, cb: Function): () => void {
     if (!this.messageListeners[action]) {
       this.messageListeners[action] = [];
@@ -71,6 +93,11 @@ class WebsocketConnection {
     console.log("Send out", message);
     this.websocket.send(JSON.stringify(message));
   }
+
+  public sendBinary(data: ArrayBuffer): void {
+    console.log("Send out binary", data.byteLength, "bytes");
+    this.websocket.send(data);
+  }
 }
 
 let socket: WebsocketConnection;
@@ -82,10 +82,10 @@ export class Canvas {
     ) {
       this.useToolAt(x, y);
 
-      // Don't update live for gradient
-      // if (appState.tools.selected !== Tools.GRADIENT) {
-      //   this.sendPixels();
-      // }
+      // Strokes are streamed while drawing, the gradient is only sent once it's done
+      if (appState.tools.selected !== Tools.GRADIENT) {
+        this.sendPixels();
+      }
     }
 
     this.lastX = Math.floor(x / appState.settings.pixelRatio);
@@ -173,9 +173,12 @@ export class Canvas {
   }
 
   private sendPixels() {
-    drawPixelAction(this.pixelData).then(() => {
-      this.pixelData = [];
-    });
+    if (this.pixelData.length === 0) {
+      return;
+    }
+
+    drawPixelAction(this.pixelData);
+    this.pixelData = [];
   }
 
   private readonly canvasToPixelData = (): PixelData[] => {
@@ -39,11 +39,11 @@ export class CanvasTextLayer {
 
     appState.text.forEach((text) => {
       const renderFunction =
-        text.font === Font.REGULAR
+        (text.font & Font.PICO) === 0
           ? DefaultTextRenderer.renderText
           : V2TextRenderer.renderText;
       const widthFunction =
-        text.font === Font.REGULAR
+        (text.font & Font.PICO) === 0
           ? DefaultTextRenderer.getWidth
           : V2TextRenderer.getWidth;
 
@@ -14,8 +14,28 @@ interface Props {
   getCanvas: () => Canvas;
 }
 
+type RemoteState = StateFromRemote & {
+  width?: number;
+  height?: number;
+  textCapacity?: number;
+};
+
 // Sync settings from esp32 back to app
-const onRemoteStateReceived = (state: StateFromRemote) => {
+const onRemoteStateReceived = ({
+  width,
+  height,
+  textCapacity,
+  ...state
+}: RemoteState) => {
+  // The matrix reports the size of its virtual display (all chained panels)
+  if (width && height) {
+    appState.settings.width = width;
+    appState.settings.height = height;
+  }
+  if (textCapacity) {
+    appState.settings.textCapacity = textCapacity;
+  }
+
   Object.keys(state).forEach((key: keyof StateFromRemote) => {
     (appState[key] as any) = state[key];
     console.log("Updated appState from remote:", key, state[key]);
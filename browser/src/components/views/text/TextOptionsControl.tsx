@@ -47,6 +47,11 @@ export const TextOptionsControl = view(
       updateTextItem(newSettings);
     };
 
+    const onScrollChange = (scroll: number) => {
+      const newSettings = { ...settings, scroll: clampValue(scroll, 0, 60) };
+      updateTextItem(newSettings);
+    };
+
     const onFontChange = (font: Font) => {
       const newSettings = { ...settings, font };
       updateTextItem(newSettings);
@@ -125,6 +130,8 @@ export const TextOptionsControl = view(
             >
               <option value={Font.REGULAR}>Regular</option>
               <option value={Font.PICO}>Pico</option>
+              <option value={Font.REGULAR_SMOOTH}>Regular (smooth)</option>
+              <option value={Font.PICO_SMOOTH}>Pico (smooth)</option>
             </select>
           </div>
         </div>
@@ -172,6 +179,16 @@ export const TextOptionsControl = view(
             step={1}
           />
         </div>
+        <div className="flex items-center">
+          <NumberInput
+            label="Scroll (px/s)"
+            value={settings.scroll ?? 0}
+            onChange={onScrollChange}
+            min={0}
+            max={60}
+            step={5}
+          />
+        </div>
         <div className="flex items-center pb-5">
           <Expandable
             expandedClassName="p-0"
@@ -3,6 +3,7 @@ import React, { useRef } from "react";
 import { setCompositionModeAction, setTextAction } from "../../../Actions";
 import {
   appState,
+  DEFAULT_TEXT_CAPACITY,
   Font,
   TextAlign,
   TextOptions,
@@ -46,7 +47,8 @@ export const TextView = view(() => {
   };
 
   const renderAddTextButton = () => {
-    if (appState.text.length < 5) {
+    const capacity = appState.settings.textCapacity ?? DEFAULT_TEXT_CAPACITY;
+    if (appState.text.length < capacity) {
       return (
         <div className="flex justify-center my-5 mb-12">
           <button className="btn btn-sm btn-primary" onClick={addTextItem}>
@@ -3,6 +3,9 @@ import { Views } from "../components/Navigation";
 import { Tools } from "../components/views/ViewWrapper";
 import { getSavedItemsFromLocalStorage, SavedItem } from "../utils/storage";
 
+// Text items older firmware takes
+export const DEFAULT_TEXT_CAPACITY = 5;
+
 export interface Settings {
   brightness: number;
   compositionMode: number;
@@ -10,6 +13,8 @@ export interface Settings {
   width: number;
   height: number;
   pixelRatio: number;
+  // Most text items the matrix takes, missing in settings saved before it reported it
+  textCapacity?: number;
 }
 
 export interface AppState {
@@ -41,12 +46,18 @@ export enum TextAlign {
   RIGHT,
 }
 
+// Bit 0 picks the font, bit 1 draws it anti-aliased (size 2 only, the matrix has no smooth
+// glyphs for other sizes)
 export enum Font {
   REGULAR,
   PICO,
+  REGULAR_SMOOTH,
+  PICO_SMOOTH,
 }
 
 export interface TextOptions {
+  // Assigned by the matrix, stays the same while the item exists
+  id?: number;
   color: string;
   text: string;
   line: number;
@@ -55,6 +66,8 @@ export interface TextOptions {
   offsetY: number;
   size: number;
   font: Font;
+  // Marquee speed in pixels per second, 0 (or missing) for static text
+  scroll?: number;
 }
 
 export interface CustomDataOptions {
@@ -106,6 +119,7 @@ const getInitialState = (): AppState => ({
     width: 64,
     height: 32,
     pixelRatio: 10,
+    textCapacity: DEFAULT_TEXT_CAPACITY,
   },
   customData: {
     updateInterval: -1,
@@ -1,4 +1,8 @@
 export function convertHexTo16Bit(input: string): string {
+  return "0x" + convertHexTo565(input).toString(16);
+}
+
+export function convertHexTo565(input: string): number {
   let RGB888 = parseInt(input.replace(/^#/, ""), 16);
   let r = (RGB888 & 0xff0000) >> 16;
   let g = (RGB888 & 0xff00) >> 8;
@@ -12,7 +16,7 @@ export function convertHexTo16Bit(input: string): string {
   RGB565 = RGB565 | (g << 5);
   RGB565 = RGB565 | b;
 
-  return "0x" + RGB565.toString(16);
+  return RGB565;
 }
 
 export function rgbToHex(r: number, g: number, b: number): string {
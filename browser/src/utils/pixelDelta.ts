@@ -0,0 +1,99 @@
+import { PixelData } from "../components/canvas/Canvas";
+import { convertHexTo565 } from "./color";
+
+// Binary pixel delta messages, see esp32/src/websocket/BinaryProtocol.h
+export const OP_PIXEL_DELTA = 0x02;
+export const OP_DELTA_ACK = 0x82;
+// Status byte of an OP_DELTA_ACK
+export const DELTA_APPLIED = 0;
+export const DELTA_DROPPED = 1; // the matrix was busy, the batch can be sent again
+export const DELTA_REJECTED = 2;
+const DELTA_HEADER_SIZE = 4;
+const DELTA_SPAN_SIZE = 7;
+const DELTA_MAX_MESSAGE_SIZE = 1024;
+const DELTA_MAX_SPANS = Math.floor((DELTA_MAX_MESSAGE_SIZE - DELTA_HEADER_SIZE) / DELTA_SPAN_SIZE);
+const MAX_SPAN_LENGTH = 255;
+
+interface DeltaSpan {
+  x: number;
+  y: number;
+  length: number;
+  color: number;
+}
+
+// Collapses pixels into horizontal single-color spans. Later pixels win when a stroke crosses
+// itself, just like they would when drawn one by one.
+const toSpans = (pixels: PixelData[], width: number): DeltaSpan[] => {
+  const colors = new Map<number, number>();
+  pixels.forEach((d) => colors.set(d.p[1] * width + d.p[0], convertHexTo565(d.c)));
+
+  const spans: DeltaSpan[] = [];
+  let last: DeltaSpan | undefined;
+
+  [...colors.keys()]
+    .sort((a, b) => a - b)
+    .forEach((index) => {
+      const x = index % width;
+      const y = Math.floor(index / width);
+      const color = colors.get(index)!;
+
+      if (
+        last &&
+        last.y === y &&
+        last.x + last.length === x &&
+        last.color === color &&
+        last.length < MAX_SPAN_LENGTH
+      ) {
+        last.length++;
+      } else {
+        last = { x, y, length: 1, color };
+        spans.push(last);
+      }
+    });
+
+  return spans;
+};
+
+// Splits the pixels into delta messages that each fit a single TCP segment. nextSeq is called
+// once per message.
+export const encodePixelDeltas = (
+  pixels: PixelData[],
+  width: number,
+  layer: number,
+  nextSeq: () => number
+): ArrayBuffer[] => {
+  const spans = toSpans(pixels, width);
+  const messages: ArrayBuffer[] = [];
+
+  for (let i = 0; i < spans.length; i += DELTA_MAX_SPANS) {
+    const batch = spans.slice(i, i + DELTA_MAX_SPANS);
+    const buffer = new ArrayBuffer(DELTA_HEADER_SIZE + batch.length * DELTA_SPAN_SIZE);
+    const view = new DataView(buffer);
+
+    view.setUint8(0, OP_PIXEL_DELTA);
+    view.setUint8(1, layer);
+    view.setUint16(2, nextSeq(), true);
+
+    batch.forEach((span, n) => {
+      const offset = DELTA_HEADER_SIZE + n * DELTA_SPAN_SIZE;
+      view.setUint16(offset, span.x, true);
+      view.setUint16(offset + 2, span.y, true);
+      view.setUint8(offset + 4, span.length);
+      view.setUint16(offset + 5, span.color, true);
+    });
+
+    messages.push(buffer);
+  }
+
+  return messages;
+};
+
+// Sequence number and status of an OP_DELTA_ACK message
+export const decodeDeltaAck = (buffer: ArrayBuffer) => {
+  const view = new DataView(buffer);
+  return {
+    action: "deltaAck",
+    seq: view.getUint16(1, true),
+    status: view.getUint8(3),
+  };
+};
@@ -0,0 +1,68 @@
+import { PixelsFromRemote } from "./storage";
+
+// Binary readback message, see esp32/src/websocket/BinaryProtocol.h
+export const OP_PIXELS = 0x81;
+const PIXELS_HEADER_SIZE = 12;
+const SOURCE_COMPOSITED = 0xff;
+const FORMAT_RGB888 = 1;
+const FLAG_RLE = 0x01;
+
+const toHex = (r: number, g: number, b: number) =>
+  "#" + ((r << 16) | (g << 8) | b).toString(16).padStart(6, "0");
+
+// Same expansion the matrix uses for its 565 -> 888 conversion
+const rgb565ToHex = (color: number) => {
+  const r = (color >> 11) & 0x1f;
+  const g = (color >> 5) & 0x3f;
+  const b = color & 0x1f;
+
+  return toHex((r * 527 + 23) >> 6, (g * 259 + 33) >> 6, (b * 527 + 23) >> 6);
+};
+
+// Decodes an OP_PIXELS message into the rows format the canvas already consumes
+export const decodePixelMessage = (buffer: ArrayBuffer): PixelsFromRemote => {
+  const view = new DataView(buffer);
+  const source = view.getUint8(1);
+  const rgb888 = view.getUint8(2) === FORMAT_RGB888;
+  const rle = (view.getUint8(3) & FLAG_RLE) !== 0;
+  const width = view.getUint16(4, true);
+  const lineStart = view.getUint16(8, true);
+  const rows = view.getUint16(10, true);
+
+  const pixels: string[] = [];
+  let offset = PIXELS_HEADER_SIZE;
+
+  while (pixels.length < width * rows && offset < buffer.byteLength) {
+    const count = rle ? view.getUint8(offset++) : 1;
+    let color: string;
+
+    if (rgb888) {
+      color = toHex(
+        view.getUint8(offset),
+        view.getUint8(offset + 1),
+        view.getUint8(offset + 2)
+      );
+      offset += 3;
+    } else {
+      color = rgb565ToHex(view.getUint16(offset, true));
+      offset += 2;
+    }
+
+    for (let i = 0; i < count; i++) {
+      pixels.push(color);
+    }
+  }
+
+  const data: string[][] = [];
+  for (let row = 0; row < rows; row++) {
+    data.push(pixels.slice(row * width, (row + 1) * width));
+  }
+
+  return {
+    action: "matrixPixels",
+    data,
+    layer: source === SOURCE_COMPOSITED ? "composited" : source,
+    "line-start": lineStart,
+    "line-end": lineStart + rows,
+  };
+};
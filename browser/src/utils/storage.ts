@@ -21,7 +21,7 @@ export type StateFromRemote = Omit<
 export interface PixelsFromRemote {
   action: "matrixPixels";
   data: string[][];
-  layer: "bg" | "text";
+  layer: number | "composited";
   "line-start": number;
   "line-end": number;
 }
@@ -0,0 +1,59 @@
+#include "FrameDump.h"
+
+namespace FrameDump {
+
+bool writePpm(const char* path, const Frame& frame)
+{
+  FILE* file = fopen(path, "wb");
+  if (!file) {
+    Serial.printf("ERROR: Cannot write %s\n", path);
+    return false;
+  }
+
+  fprintf(file, "P6\n%u %u\n255\n", frame.width, frame.height);
+  const bool ok = fwrite(frame.rgb.data(), 1, frame.rgb.size(), file) == frame.rgb.size();
+  fclose(file);
+  return ok;
+}
+
+bool readPpm(const char* path, Frame& frame)
+{
+  FILE* file = fopen(path, "rb");
+  if (!file) {
+    return false;
+  }
+
+  unsigned width, height, maxValue;
+  if (fscanf(file, "P6 %u %u %u", &width, &height, &maxValue) != 3 || maxValue != 255
+      || fgetc(file) == EOF) {
+    fclose(file);
+    return false;
+  }
+
+  frame.width = width;
+  frame.height = height;
+  frame.rgb.resize(width * height * 3);
+  const bool ok = fread(frame.rgb.data(), 1, frame.rgb.size(), file) == frame.rgb.size();
+  fclose(file);
+  return ok;
+}
+
+int32_t countDifferences(const Frame& a, const Frame& b, uint8_t tolerance)
+{
+  if (a.width != b.width || a.height != b.height) {
+    return -1;
+  }
+
+  int32_t differences = 0;
+  for (size_t i = 0; i < a.rgb.size(); i += 3) {
+    for (uint8_t c = 0; c < 3; c++) {
+      if (abs(a.rgb[i + c] - b.rgb[i + c]) > tolerance) {
+        differences++;
+        break;
+      }
+    }
+  }
+  return differences;
+}
+
+} // namespace FrameDump
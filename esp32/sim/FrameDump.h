@@ -0,0 +1,26 @@
+#pragma once
+
+#include <Arduino.h>
+#include <vector>
+
+/**
+ * FrameDump - Binary PPM (P6) frame files for the simulator
+ *
+ * PPM needs no encoder library and opens in most image viewers; convert with any tool
+ * (e.g. `convert frame.ppm frame.png`) when a PNG is needed.
+ */
+namespace FrameDump {
+
+struct Frame {
+  uint16_t width = 0;
+  uint16_t height = 0;
+  std::vector<uint8_t> rgb; // width * height * 3
+};
+
+bool writePpm(const char* path, const Frame& frame);
+bool readPpm(const char* path, Frame& frame);
+
+// Number of pixels that differ by more than tolerance in any channel, -1 if the sizes differ
+int32_t countDifferences(const Frame& a, const Frame& b, uint8_t tolerance = 0);
+
+} // namespace FrameDump
@@ -0,0 +1,130 @@
+#include "KernelCheck.h"
+#include "../src/matrix/BlendKernels.h"
+#include <cmath>
+#include <random>
+
+namespace KernelCheck {
+
+namespace {
+
+enum Kernel : uint8_t { NORMAL, ADD, MULTIPLY, KERNEL_COUNT };
+
+const char* const KERNEL_NAMES[KERNEL_COUNT] = { "normal", "add", "multiply" };
+
+// Channel layout of a 565 pixel: shift and largest value
+struct Channel {
+  uint8_t shift;
+  uint8_t max;
+};
+
+const Channel CHANNELS[3] = { { 11, 31 }, { 5, 63 }, { 0, 31 } };
+
+uint8_t channelOf(uint16_t color, const Channel& channel)
+{
+  return (color >> channel.shift) & channel.max;
+}
+
+// One channel as the kernels are meant to compute it, rounded to nearest
+uint8_t reference(Kernel kernel, uint8_t below, uint8_t above, uint8_t alpha, uint8_t max)
+{
+  const double weight = min<uint8_t>(alpha, 32) / 32.0;
+
+  switch (kernel) {
+  case NORMAL:
+    return (uint8_t)lround(below + (above - below) * weight);
+  case ADD:
+    return (uint8_t)min<long>(lround(below + above * weight), max);
+  case MULTIPLY:
+  default: {
+    const long product = lround(below * above / (double)max);
+    return (uint8_t)lround(below + (product - below) * weight);
+  }
+  }
+}
+
+uint16_t blend(Kernel kernel, uint16_t below, uint16_t above, uint8_t alpha)
+{
+  const uint32_t b = BlendKernels::expand(below);
+  const uint32_t a = BlendKernels::expand(above);
+
+  switch (kernel) {
+  case NORMAL:
+    return BlendKernels::pack(BlendKernels::normal(b, a, alpha));
+  case ADD:
+    return BlendKernels::pack(BlendKernels::add(b, a, alpha));
+  case MULTIPLY:
+  default:
+    return BlendKernels::pack(BlendKernels::multiply(b, a, alpha));
+  }
+}
+
+struct Result {
+  uint8_t maxOpaqueError = 0; // alpha 32
+  uint8_t maxBlendError = 0; // alpha 0..31
+  uint16_t below = 0;
+  uint16_t above = 0;
+  uint8_t alpha = 0;
+};
+
+void compare(Result& result, Kernel kernel, uint16_t below, uint16_t above, uint8_t alpha)
+{
+  const uint16_t color = blend(kernel, below, above, alpha);
+
+  for (const Channel& channel : CHANNELS) {
+    const uint8_t expected = reference(kernel, channelOf(below, channel),
+        channelOf(above, channel), alpha, channel.max);
+    const uint8_t error = abs(channelOf(color, channel) - expected);
+    uint8_t& worst = alpha >= 32 ? result.maxOpaqueError : result.maxBlendError;
+
+    if (error > worst) {
+      worst = error;
+      result.below = below;
+      result.above = above;
+      result.alpha = alpha;
+    }
+  }
+}
+
+} // namespace
+
+bool run(uint32_t randomPairs)
+{
+  std::mt19937 random(565);
+  bool passed = true;
+
+  for (uint8_t k = 0; k < KERNEL_COUNT; k++) {
+    const Kernel kernel = (Kernel)k;
+    Result result;
+
+    for (const Channel& channel : CHANNELS) {
+      const uint16_t mask = channel.max << channel.shift;
+      for (uint16_t below = 0; below <= channel.max; below++) {
+        for (uint16_t above = 0; above <= channel.max; above++) {
+          for (uint8_t alpha = 0; alpha <= 32; alpha++) {
+            const uint16_t otherBelow = random() & ~mask;
+            const uint16_t otherAbove = random() & ~mask;
+            compare(result, kernel, otherBelow | (below << channel.shift),
+                otherAbove | (above << channel.shift), alpha);
+          }
+        }
+      }
+    }
+
+    for (uint32_t i = 0; i < randomPairs; i++) {
+      compare(result, kernel, random(), random(), random() % 33);
+    }
+
+    const bool ok = result.maxOpaqueError == 0 && result.maxBlendError <= 1;
+    printf("%-9s max error %u opaque, %u blended\n", KERNEL_NAMES[k], result.maxOpaqueError,
+        result.maxBlendError);
+    if (!ok) {
+      printf("  FAIL: e.g. below 0x%04X above 0x%04X alpha %u\n", result.below, result.above,
+          result.alpha);
+      passed = false;
+    }
+  }
+
+  return passed;
+}
+
+} // namespace KernelCheck
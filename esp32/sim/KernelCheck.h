@@ -0,0 +1,17 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * KernelCheck - Compares the SWAR blend kernels with a scalar per-channel reference
+ *
+ * Every channel value pair is checked at every alpha, with the other channels set at random,
+ * followed by random pixel pairs. Fully opaque results have to match the reference exactly,
+ * blended ones may be one LSB off (the kernels truncate where the reference rounds).
+ */
+namespace KernelCheck {
+
+// Prints the largest difference per kernel, false if any is over its limit
+bool run(uint32_t randomPairs);
+
+} // namespace KernelCheck
@@ -0,0 +1,171 @@
+#include "OutputBench.h"
+#include "../src/matrix/ColorLut.h"
+#include "../src/matrix/LayerCompositor.h"
+#include "../src/matrix/PixelLayer.h"
+#include <ESP32-HUB75-MatrixPanel-I2S-DMA.h>
+#include <chrono>
+
+namespace OutputBench {
+
+namespace {
+
+// The output path before RowSink: every pixel goes through a static callback that looks up the
+// controller instance and hands it to drawPixelRGB888
+class CallbackSink : public RowSink {
+  public:
+  typedef void (*DrawCallback)(int16_t x, int16_t y, uint8_t r, uint8_t g, uint8_t b);
+
+  CallbackSink(MatrixPanel_I2S_DMA& panel, const ColorLut& lut)
+      : _panel(panel)
+      , _lut(lut)
+      , _callback(drawCallback)
+  {
+    instance = this;
+  }
+
+  void writeRow(int16_t x, int16_t y, const uint16_t* pixels, int16_t count) override
+  {
+    for (int16_t i = 0; i < count; i++) {
+      _callback(x + i, y, _lut.red(pixels[i]), _lut.green(pixels[i]), _lut.blue(pixels[i]));
+    }
+  }
+
+  private:
+  static void drawCallback(int16_t x, int16_t y, uint8_t r, uint8_t g, uint8_t b)
+  {
+    if (instance) {
+      instance->_panel.drawPixelRGB888(x, y, r, g, b);
+    }
+  }
+
+  static CallbackSink* instance;
+
+  MatrixPanel_I2S_DMA& _panel;
+  const ColorLut& _lut;
+  DrawCallback _callback;
+};
+
+CallbackSink* CallbackSink::instance = nullptr;
+
+// MatrixController::writeRow without dithering and tile mapping (a single panel)
+class SpanSink : public RowSink {
+  public:
+  SpanSink(MatrixPanel_I2S_DMA& panel, const ColorLut& lut)
+      : _panel(panel)
+      , _lut(lut)
+  {
+  }
+
+  void writeRow(int16_t x, int16_t y, const uint16_t* pixels, int16_t count) override
+  {
+    int16_t runStart = 0;
+
+    for (int16_t i = 1; i <= count; i++) {
+      if (i < count && pixels[i] == pixels[runStart]) {
+        continue;
+      }
+
+      const uint16_t pixel = pixels[runStart];
+      const uint8_t r = _lut.red(pixel);
+      const uint8_t g = _lut.green(pixel);
+      const uint8_t b = _lut.blue(pixel);
+
+      if (i - runStart == 1) {
+        _panel.drawPixelRGB888(x + runStart, y, r, g, b);
+      } else {
+        _panel.drawFastHLine(x + runStart, y, i - runStart, r, g, b);
+      }
+
+      runStart = i;
+    }
+  }
+
+  private:
+  MatrixPanel_I2S_DMA& _panel;
+  const ColorLut& _lut;
+};
+
+struct Timing {
+  double micros; // per frame
+  uint32_t drawCalls; // per frame
+};
+
+// Background plus a text layer with a few lines on it, the usual clock screen
+void fillFlat(PixelLayer& background, PixelLayer& text)
+{
+  background.fillScreen(0x0010);
+  for (int16_t y = 4; y < text.getLayerHeight() - 4; y += 6) {
+    text.drawFastHLine(4, y, text.getLayerWidth() - 8, 0xFFFF);
+  }
+}
+
+// Every pixel a different color, the worst case for collapsing runs
+void fillImage(PixelLayer& background, PixelLayer& text)
+{
+  for (int16_t y = 0; y < background.getLayerHeight(); y++) {
+    for (int16_t x = 0; x < background.getLayerWidth(); x++) {
+      background.drawPixel(x, y, ((x & 0x1F) << 11) | ((y & 0x3F) << 5) | ((x + y) & 0x1F));
+    }
+  }
+  text.clear();
+}
+
+Timing time(RowSink& sink, MatrixPanel_I2S_DMA& panel, PixelLayer** layers,
+    uint16_t width, uint16_t height, uint32_t iterations)
+{
+  const LayerProperties properties[2] = { { BlendMode::Normal, 255, true },
+    { BlendMode::Normal, 255, true } };
+  LayerCompositor compositor(sink, width, height);
+
+  panel.resetCounters();
+  const auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < iterations; i++) {
+    layers[0]->markAllDamaged();
+    compositor.compose(layers, properties, 2);
+  }
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+
+  return { std::chrono::duration<double, std::micro>(elapsed).count() / iterations,
+    panel.getDrawCalls() / iterations };
+}
+
+} // namespace
+
+void run(uint32_t iterations)
+{
+  static const uint16_t SIZES[][2] = { { 64, 32 }, { 128, 64 } };
+  const ColorLut lut;
+
+  printf("Output path, full frame recomposed, %u iterations\n", iterations);
+
+  for (const auto& size : SIZES) {
+    const uint16_t width = size[0];
+    const uint16_t height = size[1];
+
+    MatrixPanel_I2S_DMA panel(HUB75_I2S_CFG(width, height, 1));
+    panel.begin();
+    PixelLayer background(width, height);
+    PixelLayer text(width, height);
+    PixelLayer* layers[2] = { &background, &text };
+
+    CallbackSink callbackSink(panel, lut);
+    SpanSink spanSink(panel, lut);
+
+    for (uint8_t content = 0; content < 2; content++) {
+      if (content == 0) {
+        fillFlat(background, text);
+      } else {
+        fillImage(background, text);
+      }
+
+      const Timing callback = time(callbackSink, panel, layers, width, height, iterations);
+      const Timing span = time(spanSink, panel, layers, width, height, iterations);
+
+      printf("  %3ux%-3u %-6s callback %8.1f us %6u calls   span %8.1f us %6u calls   %4.1fx\n",
+          width, height, content == 0 ? "flat" : "image", callback.micros, callback.drawCalls,
+          span.micros, span.drawCalls, callback.micros / span.micros);
+    }
+  }
+}
+
+} // namespace OutputBench
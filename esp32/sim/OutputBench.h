@@ -0,0 +1,18 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * OutputBench - Times the compositor's output path on its own panel, independent of the
+ * simulated display size
+ *
+ * The same full frame is composited through the per-pixel callback the compositor used to have
+ * and through the row/span path MatrixController uses now, at 64x32 and 128x64, once with flat
+ * content (long runs of one color) and once with an image where every pixel differs. Both end
+ * in the driver's pixel and line calls, so only runs of equal color get cheaper.
+ */
+namespace OutputBench {
+
+void run(uint32_t iterations);
+
+} // namespace OutputBench
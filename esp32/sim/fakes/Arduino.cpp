@@ -0,0 +1,158 @@
+#include "Arduino.h"
+
+HardwareSerial Serial;
+EspClass ESP;
+
+static unsigned long simMillis = 0;
+static time_t simEpoch = 0;
+
+size_t strlcpy(char* dst, const char* src, size_t size)
+{
+  const size_t length = strlen(src);
+  if (size > 0) {
+    const size_t copied = min(length, size - 1);
+    memcpy(dst, src, copied);
+    dst[copied] = '\0';
+  }
+  return length;
+}
+
+char* itoa(int value, char* str, int base)
+{
+  if (base == 16) {
+    sprintf(str, "%x", value);
+  } else {
+    sprintf(str, "%d", value);
+  }
+  return str;
+}
+
+// ============================================================================
+// String
+// ============================================================================
+
+String::String(int value, unsigned char base) : String((long)value, base) { }
+String::String(unsigned int value, unsigned char base) : String((unsigned long)value, base) { }
+
+String::String(long value, unsigned char base)
+{
+  char buffer[24];
+  snprintf(buffer, sizeof(buffer), base == HEX ? "%lx" : "%ld", value);
+  _str = buffer;
+}
+
+String::String(unsigned long value, unsigned char base)
+{
+  char buffer[24];
+  snprintf(buffer, sizeof(buffer), base == HEX ? "%lx" : "%lu", value);
+  _str = buffer;
+}
+
+String::String(double value, unsigned char decimals)
+{
+  char buffer[32];
+  snprintf(buffer, sizeof(buffer), "%.*f", decimals, value);
+  _str = buffer;
+}
+
+int String::indexOf(char c, unsigned int from) const
+{
+  const size_t index = _str.find(c, from);
+  return index == std::string::npos ? -1 : (int)index;
+}
+
+int String::indexOf(const char* str, unsigned int from) const
+{
+  const size_t index = _str.find(str, from);
+  return index == std::string::npos ? -1 : (int)index;
+}
+
+String String::substring(unsigned int from) const
+{
+  return from < _str.size() ? String(_str.substr(from)) : String();
+}
+
+String String::substring(unsigned int from, unsigned int to) const
+{
+  if (from > to) {
+    std::swap(from, to);
+  }
+  return from < _str.size() ? String(_str.substr(from, to - from)) : String();
+}
+
+// ============================================================================
+// Print / Stream
+// ============================================================================
+
+size_t Print::print(int value, int base) { return print(String(value, base)); }
+size_t Print::print(unsigned int value, int base) { return print(String(value, base)); }
+size_t Print::print(long value, int base) { return print(String(value, base)); }
+size_t Print::print(unsigned long value, int base) { return print(String(value, base)); }
+size_t Print::print(double value, int digits) { return print(String(value, digits)); }
+
+size_t Print::printf(const char* format, ...)
+{
+  char buffer[256];
+  va_list args;
+  va_start(args, format);
+  const int length = vsnprintf(buffer, sizeof(buffer), format, args);
+  va_end(args);
+
+  if (length < 0) {
+    return 0;
+  }
+  return write((const uint8_t*)buffer, min<size_t>(length, sizeof(buffer) - 1));
+}
+
+size_t Stream::readBytes(char* buffer, size_t length)
+{
+  size_t count = 0;
+  while (count < length) {
+    const int c = read();
+    if (c < 0) {
+      break;
+    }
+    buffer[count++] = (char)c;
+  }
+  return count;
+}
+
+size_t HardwareSerial::write(uint8_t c) { return write(&c, 1); }
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size)
+{
+  if (_enabled) {
+    fwrite(buffer, 1, size, stdout);
+  }
+  return size;
+}
+
+// ============================================================================
+// Time
+// ============================================================================
+
+unsigned long millis() { return simMillis; }
+unsigned long micros() { return simMillis * 1000; }
+void delay(unsigned long ms) { simMillis += ms; }
+void yield() { }
+
+bool getLocalTime(struct tm* info, uint32_t ms)
+{
+  if (simEpoch == 0) {
+    return false;
+  }
+
+  const time_t now = simEpoch + simMillis / 1000;
+  gmtime_r(&now, info);
+  return true;
+}
+
+// The simulated clock is always UTC, so the timezone is ignored
+void configTzTime(const char* tz, const char* server1, const char* server2, const char* server3)
+{
+}
+
+namespace SimClock {
+void advance(unsigned long ms) { simMillis += ms; }
+void setEpoch(time_t epoch) { simEpoch = epoch; }
+} // namespace SimClock
@@ -0,0 +1,210 @@
+#pragma once
+
+// Host stand-in for the Arduino core, covering what the firmware modules use. Time is
+// simulated: millis() only moves when the simulator advances it, so runs are reproducible.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+// settings.h declares its own `timezone`, which clashes with the one from glibc
+#define timezone glibc_timezone
+#include <time.h>
+#undef timezone
+
+using std::max;
+using std::min;
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define PROGMEM
+#define IRAM_ATTR
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define pgm_read_pointer(addr) (*(void* const*)(addr))
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#define HEX 16
+#define DEC 10
+
+size_t strlcpy(char* dst, const char* src, size_t size);
+char* itoa(int value, char* str, int base);
+
+class String {
+  public:
+  String() { }
+  String(const char* str) : _str(str ? str : "") { }
+  String(const char* str, size_t length) : _str(str, length) { }
+  String(const std::string& str) : _str(str) { }
+  String(char c) : _str(1, c) { }
+  String(int value, unsigned char base = DEC);
+  String(unsigned int value, unsigned char base = DEC);
+  String(long value, unsigned char base = DEC);
+  String(unsigned long value, unsigned char base = DEC);
+  String(double value, unsigned char decimals = 2);
+
+  String& operator=(const char* str)
+  {
+    _str = str ? str : "";
+    return *this;
+  }
+
+  const char* c_str() const { return _str.c_str(); }
+  unsigned int length() const { return _str.length(); }
+  bool reserve(unsigned int size)
+  {
+    _str.reserve(size);
+    return true;
+  }
+
+  bool concat(const char* str)
+  {
+    _str += str ? str : "";
+    return true;
+  }
+  bool concat(const char* str, unsigned int length)
+  {
+    _str.append(str, length);
+    return true;
+  }
+  bool concat(char c)
+  {
+    _str += c;
+    return true;
+  }
+  bool concat(const String& str) { return concat(str.c_str()); }
+
+  String& operator+=(const String& str)
+  {
+    _str += str._str;
+    return *this;
+  }
+  String& operator+=(const char* str)
+  {
+    concat(str);
+    return *this;
+  }
+  String& operator+=(char c)
+  {
+    _str += c;
+    return *this;
+  }
+
+  friend String operator+(const String& a, const String& b) { return String(a._str + b._str); }
+  friend String operator+(const String& a, const char* b) { return String(a._str + b); }
+  friend String operator+(const char* a, const String& b) { return String(a + b._str); }
+
+  bool operator==(const String& other) const { return _str == other._str; }
+  bool operator==(const char* other) const { return _str == (other ? other : ""); }
+  bool operator!=(const String& other) const { return _str != other._str; }
+  bool operator!=(const char* other) const { return !(*this == other); }
+  char operator[](unsigned int index) const { return index < _str.size() ? _str[index] : 0; }
+
+  int indexOf(char c, unsigned int from = 0) const;
+  int indexOf(const char* str, unsigned int from = 0) const;
+  String substring(unsigned int from) const;
+  String substring(unsigned int from, unsigned int to) const;
+  long toInt() const { return strtol(_str.c_str(), nullptr, 10); }
+  bool isEmpty() const { return _str.empty(); }
+
+  private:
+  std::string _str;
+};
+
+class Print {
+  public:
+  virtual ~Print() { }
+
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t size)
+  {
+    size_t written = 0;
+    while (size--) {
+      written += write(*buffer++);
+    }
+    return written;
+  }
+  size_t write(const char* str) { return str ? write((const uint8_t*)str, strlen(str)) : 0; }
+
+  size_t print(const char* str) { return write(str); }
+  size_t print(const String& str) { return write(str.c_str()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int value, int base = DEC);
+  size_t print(unsigned int value, int base = DEC);
+  size_t print(long value, int base = DEC);
+  size_t print(unsigned long value, int base = DEC);
+  size_t print(double value, int digits = 2);
+
+  size_t println() { return write("\n"); }
+  template <typename T> size_t println(const T& value) { return print(value) + println(); }
+  template <typename T> size_t println(const T& value, int format)
+  {
+    return print(value, format) + println();
+  }
+
+  size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+  virtual void flush() { }
+};
+
+class Stream : public Print {
+  public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+
+  size_t readBytes(char* buffer, size_t length);
+  size_t readBytes(uint8_t* buffer, size_t length) { return readBytes((char*)buffer, length); }
+  void setTimeout(unsigned long) { }
+};
+
+// Writes to stdout. The simulator mutes it unless run verbosely.
+class HardwareSerial : public Stream {
+  public:
+  void begin(unsigned long) { }
+  void setEnabled(bool enabled) { _enabled = enabled; }
+
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+
+  private:
+  bool _enabled = true;
+};
+
+extern HardwareSerial Serial;
+
+class EspClass {
+  public:
+  uint32_t getFreeHeap() { return 0; }
+  uint32_t getHeapSize() { return 0; }
+  uint32_t getMinFreeHeap() { return 0; }
+  uint32_t getMaxAllocHeap() { return 0; }
+  void restart() { exit(0); }
+};
+
+extern EspClass ESP;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void yield();
+
+bool getLocalTime(struct tm* info, uint32_t ms = 5000);
+void configTzTime(const char* tz, const char* server1, const char* server2 = nullptr,
+    const char* server3 = nullptr);
+
+// Simulator controls
+namespace SimClock {
+void advance(unsigned long ms);
+// Wall clock time reported by getLocalTime(), 0 reports no time (NTP not synced)
+void setEpoch(time_t epoch);
+} // namespace SimClock
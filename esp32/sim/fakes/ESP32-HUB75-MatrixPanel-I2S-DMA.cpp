@@ -0,0 +1,67 @@
+#include "ESP32-HUB75-MatrixPanel-I2S-DMA.h"
+
+MatrixPanel_I2S_DMA::MatrixPanel_I2S_DMA(const HUB75_I2S_CFG& config)
+    : _width(config.mx_width * config.chain_length)
+    , _height(config.mx_height)
+    , _doubleBuffered(config.double_buff)
+    , _brightness(128)
+    , _front(0)
+    , _back(0)
+    , _pixelWrites(0)
+    , _drawCalls(0)
+{
+}
+
+bool MatrixPanel_I2S_DMA::begin()
+{
+  _buffers[0].assign(_width * _height * 3, 0);
+  _buffers[1].assign(_doubleBuffered ? _width * _height * 3 : 0, 0);
+
+  // Without double buffering every write goes straight to the displayed frame
+  _front = 0;
+  _back = _doubleBuffered ? 1 : 0;
+  return true;
+}
+
+void MatrixPanel_I2S_DMA::clearScreen()
+{
+  std::fill(_buffers[_back].begin(), _buffers[_back].end(), 0);
+}
+
+void MatrixPanel_I2S_DMA::drawPixel(int16_t x, int16_t y, uint16_t color)
+{
+  drawPixelRGB888(x, y, ((color >> 11) & 0x1F) << 3, ((color >> 5) & 0x3F) << 2,
+      (color & 0x1F) << 3);
+}
+
+void MatrixPanel_I2S_DMA::drawPixelRGB888(int16_t x, int16_t y, uint8_t r, uint8_t g, uint8_t b)
+{
+  drawFastHLine(x, y, 1, r, g, b);
+}
+
+void MatrixPanel_I2S_DMA::drawFastHLine(
+    int16_t x, int16_t y, int16_t w, uint8_t r, uint8_t g, uint8_t b)
+{
+  _drawCalls++;
+  if (y < 0 || y >= _height || _buffers[_back].empty()) {
+    return;
+  }
+
+  const int16_t x0 = max<int16_t>(x, 0);
+  const int16_t x1 = min<int16_t>(x + w, _width);
+
+  for (int16_t i = x0; i < x1; i++) {
+    uint8_t* pixel = &_buffers[_back][(y * _width + i) * 3];
+    pixel[0] = r;
+    pixel[1] = g;
+    pixel[2] = b;
+    _pixelWrites++;
+  }
+}
+
+void MatrixPanel_I2S_DMA::flipDMABuffer()
+{
+  if (_doubleBuffered) {
+    std::swap(_front, _back);
+  }
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+// Host stand-in for the HUB75 DMA driver. Frames land in RGB888 memory buffers laid out like
+// the real chain (PANEL_CHAIN panels side by side), with the same double buffer semantics.
+
+#include <Arduino.h>
+#include <vector>
+
+struct HUB75_I2S_CFG {
+  enum clk_speed { HZ_8M = 8000000, HZ_10M = 10000000, HZ_15M = 15000000, HZ_20M = 20000000 };
+
+  struct i2s_pins {
+    int8_t r1, g1, b1, r2, g2, b2, a, b, c, d, e, lat, oe, clk;
+  };
+
+  uint16_t mx_width;
+  uint16_t mx_height;
+  uint16_t chain_length;
+  i2s_pins gpio;
+  clk_speed i2sspeed = HZ_8M;
+  uint16_t min_refresh_rate = 60;
+  bool double_buff = false;
+
+  HUB75_I2S_CFG(uint16_t width = 64, uint16_t height = 32, uint16_t chain = 1,
+      i2s_pins pins = {})
+      : mx_width(width)
+      , mx_height(height)
+      , chain_length(chain)
+      , gpio(pins)
+  {
+  }
+};
+
+class MatrixPanel_I2S_DMA {
+  public:
+  explicit MatrixPanel_I2S_DMA(const HUB75_I2S_CFG& config);
+
+  bool begin();
+  void setBrightness8(uint8_t brightness) { _brightness = brightness; }
+  void clearScreen();
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color);
+  void drawPixelRGB888(int16_t x, int16_t y, uint8_t r, uint8_t g, uint8_t b);
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint8_t r, uint8_t g, uint8_t b);
+  void flipDMABuffer();
+
+  // Simulator access
+  uint16_t getChainWidth() const { return _width; }
+  uint16_t getChainHeight() const { return _height; }
+  uint8_t getBrightness() const { return _brightness; }
+  // RGB888 frame currently shown by the panel
+  const uint8_t* getDisplayedFrame() const { return _buffers[_front].data(); }
+  // Pixel writes issued since the last reset, line fills count every pixel they cover
+  uint32_t getPixelWrites() const { return _pixelWrites; }
+  uint32_t getDrawCalls() const { return _drawCalls; }
+  void resetCounters()
+  {
+    _pixelWrites = 0;
+    _drawCalls = 0;
+  }
+
+  private:
+  uint16_t _width;
+  uint16_t _height;
+  bool _doubleBuffered;
+  uint8_t _brightness;
+  uint8_t _front;
+  uint8_t _back;
+  std::vector<uint8_t> _buffers[2];
+  uint32_t _pixelWrites;
+  uint32_t _drawCalls;
+};
@@ -0,0 +1,97 @@
+#pragma once
+
+// Host stand-in for the AsyncWebSocket API. Outgoing messages are recorded instead of sent, so
+// the simulator can inspect what the handlers reply.
+
+#include <Arduino.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+typedef enum { WS_CONTINUATION, WS_TEXT, WS_BINARY, WS_DISCONNECT = 0x08, WS_PING, WS_PONG } AwsFrameType;
+typedef enum { WS_EVT_CONNECT, WS_EVT_DISCONNECT, WS_EVT_PING, WS_EVT_PONG, WS_EVT_ERROR, WS_EVT_DATA } AwsEventType;
+
+typedef struct {
+  uint8_t message_opcode;
+  uint32_t num;
+  uint8_t final;
+  uint8_t masked;
+  uint8_t opcode;
+  uint64_t len;
+  uint8_t mask[4];
+  uint64_t index;
+} AwsFrameInfo;
+
+using AsyncWebSocketSharedBuffer = std::shared_ptr<std::vector<uint8_t>>;
+
+class IPAddress {
+  public:
+  String toString() const { return "127.0.0.1"; }
+};
+
+class AsyncWebSocketClient {
+  public:
+  explicit AsyncWebSocketClient(uint32_t id = 1) : _id(id) { }
+
+  uint32_t id() const { return _id; }
+  IPAddress remoteIP() const { return IPAddress(); }
+
+  bool canSend() const { return true; }
+  // Messages are recorded right away, nothing ever waits
+  size_t queueLen() const { return 0; }
+  void close() { }
+
+  void text(AsyncWebSocketSharedBuffer message)
+  {
+    sent.emplace_back(message->begin(), message->end());
+  }
+  void binary(AsyncWebSocketSharedBuffer message) { sentBinary.push_back(*message); }
+  void binary(const uint8_t* message, size_t length)
+  {
+    sentBinary.emplace_back(message, message + length);
+  }
+
+  // Every message sent to this client alone, oldest first
+  std::vector<std::string> sent;
+  std::vector<std::vector<uint8_t>> sentBinary;
+
+  private:
+  uint32_t _id;
+};
+
+class AsyncWebSocket {
+  public:
+  explicit AsyncWebSocket(const char* url) { }
+
+  void textAll(const String& message) { sent.push_back(message.c_str()); }
+  void textAll(const char* message, size_t length) { sent.emplace_back(message, length); }
+  void textAll(AsyncWebSocketSharedBuffer message)
+  {
+    sent.emplace_back(message->begin(), message->end());
+  }
+  void binaryAll(const uint8_t* message, size_t length)
+  {
+    sentBinary.emplace_back(message, message + length);
+  }
+  void cleanupClients(uint16_t maxClients = 8) { }
+  size_t count() const { return _clients.size(); }
+
+  // Simulator control: makes client known to client(id)
+  void connect(AsyncWebSocketClient* client) { _clients.push_back(client); }
+  AsyncWebSocketClient* client(uint32_t id)
+  {
+    for (AsyncWebSocketClient* c : _clients) {
+      if (c->id() == id) {
+        return c;
+      }
+    }
+    return nullptr;
+  }
+
+  // Every message passed to textAll / binaryAll, oldest first
+  std::vector<std::string> sent;
+  std::vector<std::vector<uint8_t>> sentBinary;
+
+  private:
+  std::vector<AsyncWebSocketClient*> _clients;
+};
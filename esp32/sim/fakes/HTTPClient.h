@@ -0,0 +1,13 @@
+#pragma once
+
+// Host stand-in for HTTPClient. The simulator has no network, so every request fails.
+
+#include <Arduino.h>
+
+class HTTPClient {
+  public:
+  bool begin(const char* url) { return true; }
+  int GET() { return -1; }
+  String getString() { return String(); }
+  void end() { }
+};
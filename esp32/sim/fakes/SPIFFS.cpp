@@ -0,0 +1,3 @@
+#include "SPIFFS.h"
+
+SPIFFSFS SPIFFS;
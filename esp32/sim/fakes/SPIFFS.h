@@ -0,0 +1,57 @@
+#pragma once
+
+// Host stand-in for SPIFFS, backed by memory so every simulator run starts from defaults
+
+#include <Arduino.h>
+#include <map>
+#include <string>
+
+class File : public Stream {
+  public:
+  File() : _data(nullptr), _position(0) { }
+  explicit File(std::string* data) : _data(data), _position(0) { }
+
+  explicit operator bool() const { return _data != nullptr; }
+  void close() { _data = nullptr; }
+  size_t size() const { return _data ? _data->size() : 0; }
+
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t* buffer, size_t size) override
+  {
+    if (!_data) {
+      return 0;
+    }
+    _data->append((const char*)buffer, size);
+    return size;
+  }
+
+  int available() override { return _data ? _data->size() - _position : 0; }
+  int read() override { return available() > 0 ? (uint8_t)(*_data)[_position++] : -1; }
+  int peek() override { return available() > 0 ? (uint8_t)(*_data)[_position] : -1; }
+
+  private:
+  std::string* _data;
+  size_t _position;
+};
+
+class SPIFFSFS {
+  public:
+  bool begin(bool formatOnFail = false) { return true; }
+  bool exists(const char* path) const { return _files.count(path) > 0; }
+  bool remove(const char* path) { return _files.erase(path) > 0; }
+
+  File open(const char* path, const char* mode = "r")
+  {
+    if (mode[0] == 'w') {
+      _files[path].clear();
+    } else if (!exists(path)) {
+      return File();
+    }
+    return File(&_files[path]);
+  }
+
+  private:
+  std::map<std::string, std::string> _files;
+};
+
+extern SPIFFSFS SPIFFS;
@@ -0,0 +1,586 @@
+// Headless render simulator: drives the firmware's matrix, text and WebSocket modules against
+// the fakes in sim/fakes, dumps the resulting panel frames and optionally compares them to a
+// previously recorded set.
+//
+//   pio run -e native && .pio/build/native/program --out frames
+//   .pio/build/native/program --golden frames        # exit code 1 on any difference
+//   .pio/build/native/program --bench 1000           # full-frame render timings
+
+#include "../src/config/ConfigManager.h"
+#include "../src/config/settings.h"
+#include "../src/data/CustomDataHandler.h"
+#include "../src/display/TextDisplayHandler.h"
+#include "../src/display/TextItemPool.h"
+#include "../src/matrix/MatrixController.h"
+#include "../src/websocket/BinaryProtocol.h"
+#include "../src/websocket/WebSocketHandler.h"
+#include "FrameDump.h"
+#include "KernelCheck.h"
+#include "OutputBench.h"
+#include <Arduino.h>
+#include <SPIFFS.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+// Globals the WebSocket handlers expect from main.cpp
+char currentTimezone[64];
+boolean showText = true;
+boolean lastshowText = false;
+int customDataUpdateInterval = -1;
+boolean customDataEnabled = false;
+char customDataServer[128] = "";
+void resetWifi() { }
+
+static ConfigManager& config = ConfigManager::getInstance();
+static MatrixController matrix;
+static TextItemPool textItems;
+static TextDisplayHandler textDisplay(matrix, textItems);
+static CustomDataHandler customData;
+static AsyncWebSocket ws("/ws");
+static AsyncWebSocketClient client;
+
+// Fixed wall clock (2024-03-09 12:34:56 UTC) so clock scenes render the same every run
+static const time_t SIM_EPOCH = 1709987696;
+static const unsigned long FRAME_MILLIS = 1000 / RENDER_TARGET_FPS;
+
+// ============================================================================
+// DRIVING THE FIRMWARE
+// ============================================================================
+
+// Feeds a message through the WebSocket handler as a single text frame
+static void send(const std::string& message)
+{
+  AwsFrameInfo info = {};
+  info.final = 1;
+  info.opcode = WS_TEXT;
+  info.message_opcode = WS_TEXT;
+  info.len = message.size();
+
+  WebSocketHandler::handleMessage(&client, &info, (uint8_t*)message.data(), message.size());
+}
+
+static void sendBinary(const std::vector<uint8_t>& message)
+{
+  AwsFrameInfo info = {};
+  info.final = 1;
+  info.opcode = WS_BINARY;
+  info.message_opcode = WS_BINARY;
+  info.len = message.size();
+
+  WebSocketHandler::handleMessage(&client, &info, (uint8_t*)message.data(), message.size());
+}
+
+// Delivers a binary message the way AsyncWebSocket does for large uploads: split into
+// frameSize WebSocket frames, each arriving in TCP chunks of at most chunkSize bytes
+static void sendBinaryStreamed(
+    const std::vector<uint8_t>& message, size_t frameSize, size_t chunkSize)
+{
+  for (size_t frameStart = 0; frameStart < message.size(); frameStart += frameSize) {
+    AwsFrameInfo info = {};
+    info.opcode = frameStart == 0 ? WS_BINARY : WS_CONTINUATION;
+    info.message_opcode = WS_BINARY;
+    info.num = frameStart / frameSize;
+    info.len = min(frameSize, message.size() - frameStart);
+    info.final = frameStart + info.len == message.size();
+
+    for (info.index = 0; info.index < info.len; info.index += chunkSize) {
+      const size_t len = min<size_t>(chunkSize, info.len - info.index);
+      WebSocketHandler::handleMessage(
+          &client, &info, (uint8_t*)message.data() + frameStart + info.index, len);
+      // The render task keeps draining the queue while a large upload streams in
+      WebSocketHandler::applyCommands();
+    }
+  }
+}
+
+// OP_BLIT_RGB565 message for a rectangle filled by color(x, y)
+static std::vector<uint8_t> blitMessage(uint8_t layer, uint16_t x, uint16_t y, uint16_t width,
+    uint16_t height, uint16_t (*color)(uint16_t x, uint16_t y))
+{
+  const uint16_t header[] = { x, y, width, height };
+  std::vector<uint8_t> message = { BinaryProtocol::OP_BLIT_RGB565, layer };
+
+  for (uint16_t value : header) {
+    message.push_back(value & 0xFF);
+    message.push_back(value >> 8);
+  }
+  for (uint16_t row = 0; row < height; row++) {
+    for (uint16_t column = 0; column < width; column++) {
+      const uint16_t c = color(column, row);
+      message.push_back(c & 0xFF);
+      message.push_back(c >> 8);
+    }
+  }
+
+  return message;
+}
+
+// Same work as renderFrame() in main.cpp, minus the startup screen and reset button
+static void renderFrame()
+{
+  WebSocketHandler::applyCommands();
+  if (showText) {
+    textDisplay.renderText();
+  }
+  matrix.render(config.getCompositionMode());
+  SimClock::advance(FRAME_MILLIS);
+}
+
+static void resetScene()
+{
+  send("{\"action\":\"clear\"}");
+  for (uint8_t i = 0; i < matrix.getLayerCount(); i++) {
+    send("{\"action\":\"setLayer\",\"layer\":" + std::to_string(i)
+        + ",\"visible\":true,\"opacity\":255,\"blend\":\"normal\"}");
+  }
+  matrix.clear();
+  send("{\"action\":\"toggleClock\",\"visible\":false}");
+  send("{\"action\":\"compositionMode\",\"mode\":0}");
+  send("{\"action\":\"setBrightness\",\"brightness\":" + std::to_string(DEFAULT_BRIGHTNESS) + "}");
+}
+
+// Diagonal RGB565 gradient covering the whole display
+static std::string gradientImage()
+{
+  std::string message = "{\"action\":\"drawImage\",\"data\":[";
+  char hex[8];
+
+  for (uint16_t y = 0; y < matrix.getHeight(); y++) {
+    for (uint16_t x = 0; x < matrix.getWidth(); x++) {
+      const uint16_t r = x * 31 / (matrix.getWidth() - 1);
+      const uint16_t g = y * 63 / (matrix.getHeight() - 1);
+      const uint16_t b = 31 - r;
+      snprintf(hex, sizeof(hex), "\"%04X\"", (r << 11) | (g << 5) | b);
+
+      if (x || y) {
+        message += ',';
+      }
+      message += hex;
+    }
+  }
+
+  return message + "]}";
+}
+
+// ============================================================================
+// SCENES
+// ============================================================================
+
+static void sceneClock() { send("{\"action\":\"toggleClock\",\"visible\":true}"); }
+
+static void sceneImage() { send(gradientImage()); }
+
+static void sceneLayers()
+{
+  send("{\"action\":\"fill\",\"color\":\"0010\"}");
+  send("{\"action\":\"drawpixel\",\"layer\":1,\"data\":["
+       "{\"p\":[2,2],\"c\":\"F800\"},{\"p\":[3,3],\"c\":\"F800\"},{\"p\":[4,4],\"c\":\"07E0\"},"
+       "{\"p\":[5,5],\"c\":\"07E0\"},{\"p\":[6,6],\"c\":\"FFFF\"}]}");
+  send("{\"action\":\"setLayer\",\"layer\":1,\"blend\":\"add\"}");
+  send("{\"action\":\"toggleClock\",\"visible\":true}");
+  send("{\"action\":\"compositionMode\",\"mode\":1}");
+}
+
+static void sceneSilhouette()
+{
+  send(gradientImage());
+  send("{\"action\":\"toggleClock\",\"visible\":true}");
+  send("{\"action\":\"compositionMode\",\"mode\":2}");
+}
+
+static void sceneDim()
+{
+  send(gradientImage());
+  send("{\"action\":\"setBrightness\",\"brightness\":1}");
+}
+
+static uint16_t checker(uint16_t x, uint16_t y) { return ((x ^ y) & 2) ? 0xFFE0 : 0x001F; }
+
+static void sceneBlit()
+{
+  sendBinary(blitMessage(0, 8, 4, 16, 8, checker));
+  // Partly off the right edge, clipped by the layer
+  sendBinary(blitMessage(1, matrix.getWidth() - 6, 10, 12, 6, checker));
+}
+
+static uint16_t stripes(uint16_t x, uint16_t y) { return (y & 4) ? 0xF81F : (x << 11); }
+
+// Full-display upload in odd sized pieces, so both the header and single pixels are split
+static void sceneStreamedBlit()
+{
+  const std::vector<uint8_t> image
+      = blitMessage(0, 0, 0, matrix.getWidth(), matrix.getHeight(), stripes);
+  sendBinaryStreamed(image, 1001, 7);
+}
+
+// OP_PIXEL_DELTA batch drawing a diagonal stroke of short spans
+static std::vector<uint8_t> strokeDelta(uint16_t seq, uint16_t x0, uint16_t color)
+{
+  std::vector<uint8_t> message = { BinaryProtocol::OP_PIXEL_DELTA, 0, (uint8_t)(seq & 0xFF),
+    (uint8_t)(seq >> 8) };
+
+  for (uint16_t y = 0; y < matrix.getHeight(); y++) {
+    const uint16_t span[] = { (uint16_t)(x0 + y), y };
+    for (uint16_t value : span) {
+      message.push_back(value & 0xFF);
+      message.push_back(value >> 8);
+    }
+    message.push_back(3);
+    message.push_back(color & 0xFF);
+    message.push_back(color >> 8);
+  }
+
+  return message;
+}
+
+// Pipelined brush strokes: several batches in flight, one of them split into small TCP chunks
+static void sceneStroke()
+{
+  const size_t acksBefore = client.sentBinary.size();
+
+  sendBinary(strokeDelta(1, 0, 0xF800));
+  sendBinary(strokeDelta(2, 12, 0x07E0));
+  sendBinaryStreamed(strokeDelta(3, 24, 0x001F), 4096, 5);
+  WebSocketHandler::applyCommands();
+
+  if (client.sentBinary.size() - acksBefore != 3) {
+    printf("stroke: expected 3 delta acks, got %u\n",
+        (unsigned)(client.sentBinary.size() - acksBefore));
+  }
+}
+
+// Saved layout restored as one transaction: text, settings and the background image
+static void sceneRestore()
+{
+  send("{\"action\":\"toggleClock\",\"visible\":true}");
+  send("{\"action\":\"applyScene\",\"image\":true,\"compositionMode\":2,\"text\":["
+       "{\"text\":\"%H:%M\",\"color\":\"FFE0\",\"offsetX\":-1,\"offsetY\":-5,\"align\":1,"
+       "\"size\":1,\"line\":2,\"font\":1}]}");
+
+  // Nothing of the scene may show before its image is there
+  WebSocketHandler::applyCommands();
+  if (config.getCompositionMode() == 2) {
+    printf("restore: scene applied before its image arrived\n");
+  }
+
+  const std::vector<uint8_t> image
+      = blitMessage(0, 0, 0, matrix.getWidth(), matrix.getHeight(), stripes);
+  sendBinaryStreamed(image, 1001, 512);
+}
+
+// OP_STREAM_FRAME message for the whole display, stamped at timestamp ms on the sender's clock
+static std::vector<uint8_t> streamFrame(
+    uint32_t timestamp, uint16_t (*color)(uint16_t x, uint16_t y))
+{
+  std::vector<uint8_t> message = { BinaryProtocol::OP_STREAM_FRAME };
+
+  for (int shift = 0; shift < 32; shift += 8) {
+    message.push_back((timestamp >> shift) & 0xFF);
+  }
+  for (uint16_t y = 0; y < matrix.getHeight(); y++) {
+    for (uint16_t x = 0; x < matrix.getWidth(); x++) {
+      const uint16_t c = color(x, y);
+      message.push_back(c & 0xFF);
+      message.push_back(c >> 8);
+    }
+  }
+
+  return message;
+}
+
+// Live frames under the clock: one shown on arrival, one a frame later and one that arrives too
+// late and is dropped
+static void sceneStream()
+{
+  const FrameStream::Stats before = WebSocketHandler::getFrameStreamStats();
+
+  send("{\"action\":\"toggleClock\",\"visible\":true}");
+  send("{\"action\":\"stream\",\"enabled\":true,\"layer\":0,\"delay\":0}");
+  WebSocketHandler::applyCommands();
+
+  sendBinary(streamFrame(5000, checker));
+  sendBinaryStreamed(streamFrame(5000 + FRAME_MILLIS, stripes), 65536, 700);
+  WebSocketHandler::applyCommands();
+
+  SimClock::advance(FRAME_MILLIS * 6);
+  sendBinary(streamFrame(5000 + FRAME_MILLIS * 2, checker));
+  WebSocketHandler::applyCommands();
+
+  send("{\"action\":\"stream\",\"enabled\":false}");
+  WebSocketHandler::applyCommands();
+
+  const FrameStream::Stats after = WebSocketHandler::getFrameStreamStats();
+  if (after.received - before.received != 3 || after.presented - before.presented != 2
+      || after.late - before.late != 1) {
+    printf("stream: expected 3 received, 2 presented, 1 late, got %u, %u, %u\n",
+        after.received - before.received, after.presented - before.presented,
+        after.late - before.late);
+  }
+}
+
+// Ticker longer than the display scrolling under a static clock, caught mid-way
+static void sceneMarquee()
+{
+  send("{\"action\":\"toggleClock\",\"visible\":true}");
+  send("{\"action\":\"setText\",\"text\":["
+       "{\"text\":\"%H:%M\",\"color\":\"FFFF\",\"offsetX\":0,\"offsetY\":1,\"align\":1,"
+       "\"size\":1,\"line\":0,\"font\":0},"
+       "{\"text\":\"Custom data ticker, far longer than the thirty two bytes it used to be cut "
+       "at\",\"color\":\"07E0\",\"offsetX\":0,\"offsetY\":-1,\"align\":0,\"size\":1,"
+       "\"line\":2,\"font\":0,\"scroll\":30}]}");
+
+  for (int frame = 0; frame < 60; frame++) {
+    renderFrame();
+  }
+}
+
+// Ticker too large for a marquee strip, shown standing still and cut at the right edge
+static void sceneClippedMarquee()
+{
+  send("{\"action\":\"toggleClock\",\"visible\":true}");
+  send("{\"action\":\"setText\",\"text\":["
+       "{\"text\":\"Far too large to scroll, this ticker needs more than the strip may take\","
+       "\"color\":\"F81F\",\"offsetX\":0,\"offsetY\":0,\"align\":0,\"size\":3,"
+       "\"line\":1,\"font\":0,\"scroll\":30}]}");
+  renderFrame();
+
+  const PixelLayer& layer = matrix.getTextLayer();
+  uint32_t drawn = 0;
+  for (int16_t y = 0; y < layer.getLayerHeight(); y++) {
+    for (int16_t x = 0; x < layer.getLayerWidth(); x++) {
+      drawn += layer.getPixel(x, y) != layer.transparencyColor;
+    }
+  }
+  if (drawn == 0) {
+    printf("clipped: the oversized ticker is not shown\n");
+  }
+}
+
+// Single items changed and removed by id, without resending the list
+static void sceneTextItems()
+{
+  send("{\"action\":\"toggleClock\",\"visible\":true}");
+  send("{\"action\":\"setText\",\"text\":["
+       "{\"text\":\"%H:%M\",\"color\":\"FFFF\",\"align\":1,\"size\":1,\"line\":0},"
+       "{\"text\":\"one\",\"color\":\"07E0\",\"align\":0,\"size\":1,\"line\":1},"
+       "{\"text\":\"two\",\"color\":\"001F\",\"align\":0,\"size\":1,\"line\":2}]}");
+  renderFrame();
+
+  send("{\"action\":\"updateText\",\"id\":3,\"text\":\"three\",\"color\":\"F800\"}");
+  send("{\"action\":\"removeText\",\"id\":2}");
+  send("{\"action\":\"updateText\",\"id\":40,\"text\":\"new\",\"align\":2,\"line\":1}");
+  renderFrame();
+
+  if (textItems.count() != 3 || textItems.getId(1) != 3 || textItems.getId(2) != 40
+      || strcmp(textItems.getText(1), "three") != 0 || textItems.getStyle(1).color != 0xF800) {
+    printf("items: expected items 1, 3 (\"three\", red) and 40, got %u items\n",
+        (unsigned)textItems.count());
+  }
+}
+
+// Anti-aliased regular and pico text at the size the glyph tables are generated for
+static void sceneSmoothText()
+{
+  send("{\"action\":\"toggleClock\",\"visible\":true}");
+  send("{\"action\":\"setText\",\"text\":["
+       "{\"text\":\"%H:%M\",\"color\":\"FFFF\",\"offsetX\":0,\"offsetY\":1,\"align\":1,"
+       "\"size\":2,\"line\":0,\"font\":2},"
+       "{\"text\":\"Sat 9\",\"color\":\"FD20\",\"offsetX\":0,\"offsetY\":-1,\"align\":1,"
+       "\"size\":2,\"line\":2,\"font\":3}]}");
+  renderFrame();
+}
+
+struct Scene {
+  const char* name;
+  void (*setup)();
+};
+
+static const Scene scenes[] = {
+  { "clock", sceneClock },
+  { "image", sceneImage },
+  { "layers", sceneLayers },
+  { "silhouette", sceneSilhouette },
+  { "dim", sceneDim },
+  { "blit", sceneBlit },
+  { "streamed", sceneStreamedBlit },
+  { "stroke", sceneStroke },
+  { "stream", sceneStream },
+  // Last, these replace the text items the other scenes use
+  { "marquee", sceneMarquee },
+  { "clipped", sceneClippedMarquee },
+  { "items", sceneTextItems },
+  { "smooth", sceneSmoothText },
+  { "restore", sceneRestore },
+};
+
+// ============================================================================
+// CAPTURE
+// ============================================================================
+
+// Reads the displayed chain buffer back in virtual display coordinates
+static void captureFrame(FrameDump::Frame& frame)
+{
+  MatrixPanel_I2S_DMA* panel = matrix.getPanel();
+  const uint8_t* chain = panel->getDisplayedFrame();
+
+  frame.width = matrix.getWidth();
+  frame.height = matrix.getHeight();
+  frame.rgb.resize(frame.width * frame.height * 3);
+
+  for (int16_t y = 0; y < frame.height; y++) {
+    for (int16_t x = 0; x < frame.width; x++) {
+      int16_t chainX, chainY;
+      DisplayGeometry::toChain(x, y, chainX, chainY);
+      memcpy(&frame.rgb[(y * frame.width + x) * 3],
+          &chain[(chainY * panel->getChainWidth() + chainX) * 3], 3);
+    }
+  }
+}
+
+static void benchmark(const char* name, uint32_t iterations)
+{
+  MatrixPanel_I2S_DMA* panel = matrix.getPanel();
+  panel->resetCounters();
+
+  const auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < iterations; i++) {
+    // Worst case: the whole frame is recomposed and pushed
+    matrix.getBackgroundLayer().markAllDamaged();
+    renderFrame();
+  }
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  const double micros = std::chrono::duration<double, std::micro>(elapsed).count();
+
+  printf("  %-12s %8.1f us/frame  %6u pixel writes/frame  %6u draw calls/frame\n", name,
+      micros / iterations, panel->getPixelWrites() / iterations,
+      panel->getDrawCalls() / iterations);
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main(int argc, char** argv)
+{
+  const char* outDir = nullptr;
+  const char* goldenDir = nullptr;
+  uint32_t benchIterations = 0;
+  uint32_t outputBenchIterations = 0;
+  uint32_t frames = 2;
+  int tolerance = 0;
+  bool verbose = false;
+  bool checkKernels = false;
+
+  for (int i = 1; i < argc; i++) {
+    const std::string arg = argv[i];
+    const bool hasValue = i + 1 < argc;
+
+    if (arg == "--out" && hasValue) {
+      outDir = argv[++i];
+    } else if (arg == "--golden" && hasValue) {
+      goldenDir = argv[++i];
+    } else if (arg == "--bench" && hasValue) {
+      benchIterations = strtoul(argv[++i], nullptr, 10);
+    } else if (arg == "--bench-output" && hasValue) {
+      outputBenchIterations = strtoul(argv[++i], nullptr, 10);
+    } else if (arg == "--frames" && hasValue) {
+      frames = max<uint32_t>(1, strtoul(argv[++i], nullptr, 10));
+    } else if (arg == "--tolerance" && hasValue) {
+      tolerance = constrain(atoi(argv[++i]), 0, 255);
+    } else if (arg == "--verbose") {
+      verbose = true;
+    } else if (arg == "--check-kernels") {
+      checkKernels = true;
+    } else {
+      printf("usage: %s [--out DIR] [--golden DIR] [--tolerance N] [--frames N] "
+             "[--bench N] [--bench-output N] [--check-kernels] [--verbose]\n",
+          argv[0]);
+      return 2;
+    }
+  }
+
+  Serial.setEnabled(verbose);
+
+  if (checkKernels) {
+    return KernelCheck::run(1000000) ? 0 : 1;
+  }
+  if (outputBenchIterations > 0) {
+    OutputBench::run(outputBenchIterations);
+    return 0;
+  }
+  SimClock::setEpoch(SIM_EPOCH);
+
+  SPIFFS.begin();
+  config.begin();
+  textDisplay.setLocale(config.getLocale());
+  textItems.set(0, "%H:%M", { 0xFFFF, -1, -5, 1, 2, 1 });
+  textItems.set(0, "%d.%b", { 0xFFFF, 2, -3, 1, 1, 2 });
+  strlcpy(currentTimezone, config.getTimezone(), sizeof(currentTimezone));
+
+  matrix.begin(MATRIX_DOUBLE_BUFFER);
+  WebSocketHandler::init(&matrix, &textItems, &ws, SOCKET_DATA_SIZE, &textDisplay, &customData);
+  ws.connect(&client);
+  WebSocketHandler::onConnect(&client);
+
+  printf("Simulating %ux%u display (%ux%u panels)\n", matrix.getWidth(), matrix.getHeight(),
+      PANEL_TILE_COLS, PANEL_TILE_ROWS);
+
+  int failures = 0;
+
+  for (const Scene& scene : scenes) {
+    resetScene();
+    scene.setup();
+
+    for (uint32_t f = 0; f < frames; f++) {
+      renderFrame();
+    }
+
+    FrameDump::Frame frame;
+    captureFrame(frame);
+
+    // Size of what a browser gets back when it asks for the composited frame
+    client.sentBinary.clear();
+    send("{\"action\":\"getPixels\",\"composited\":true}");
+    WebSocketHandler::applyCommands();
+    size_t readbackBytes = 0;
+    for (const std::vector<uint8_t>& message : client.sentBinary) {
+      readbackBytes += message.size();
+    }
+
+    printf("%-12s %5u pixels pushed in the last frame, %5u bytes readback\n", scene.name,
+        matrix.getPixelsPushed(), (unsigned)readbackBytes);
+
+    if (outDir) {
+      const std::string path = std::string(outDir) + "/" + scene.name + ".ppm";
+      FrameDump::writePpm(path.c_str(), frame);
+    }
+
+    if (goldenDir) {
+      const std::string path = std::string(goldenDir) + "/" + scene.name + ".ppm";
+      FrameDump::Frame golden;
+
+      if (!FrameDump::readPpm(path.c_str(), golden)) {
+        printf("  FAIL: no golden frame at %s\n", path.c_str());
+        failures++;
+      } else {
+        const int32_t differences = FrameDump::countDifferences(frame, golden, tolerance);
+        if (differences != 0) {
+          printf("  FAIL: %d pixels differ from %s\n", differences, path.c_str());
+          failures++;
+        }
+      }
+    }
+
+    if (benchIterations > 0) {
+      benchmark(scene.name, benchIterations);
+    }
+  }
+
+  if (goldenDir) {
+    printf("%d of %u scenes differ from the golden frames\n", failures,
+        (unsigned)(sizeof(scenes) / sizeof(scenes[0])));
+  }
+
+  return failures > 0 ? 1 : 0;
+}
@@ -24,4 +24,11 @@
 // Matrix Configuration
 #define PANEL_WIDTH 64
 #define PANEL_HEIGHT 32
-#define PANEL_CHAIN 1
\ No newline at end of file
+// Panels are tiled into one virtual display of PANEL_TILE_COLS x PANEL_TILE_ROWS panels,
+// e.g. 2x2 for 128x64 or 4x1 for 256x32. The chain enters at the top left panel and runs
+// left to right. With PANEL_SERPENTINE every other panel row runs back right to left and is
+// mounted upside down (short cables); without it every row starts on the left.
+#define PANEL_TILE_COLS 1
+#define PANEL_TILE_ROWS 1
+#define PANEL_SERPENTINE 1
+#define PANEL_CHAIN (PANEL_TILE_COLS * PANEL_TILE_ROWS)
\ No newline at end of file
@@ -12,13 +12,69 @@ extern const char* hostname;
 
 // Display Settings
 const int MAX_BRIGHTNESS = 15;
-const int MIN_BRIGHTNESS = 3;
+const int MIN_BRIGHTNESS = 1;
 const int DEFAULT_BRIGHTNESS = 3;
+// The panel goes black below this hardware brightness; lower levels are dimmed in the color LUT
+const int MIN_PANEL_BRIGHTNESS = 3;
+// Gamma applied by the color LUT (replaces the driver's CIE1931 table, see platformio.ini)
+const float DISPLAY_GAMMA = 2.2f;
+// Temporal dithering recovers the dark shades gamma would crush to black. It re-pushes the
+// whole frame every tick, so it only runs at or below this brightness (0 disables it): the
+// levels dimmed in the color LUT, where those shades are lost. DEFAULT_BRIGHTNESS has to stay
+// above it, or the default setting pays for a full frame every tick.
+const int TEMPORAL_DITHER_MAX_BRIGHTNESS = MIN_PANEL_BRIGHTNESS - 1;
+static_assert(DEFAULT_BRIGHTNESS > TEMPORAL_DITHER_MAX_BRIGHTNESS,
+    "the default brightness must not run temporal dithering");
+// Depth of the layer stack (background, effects, text, overlay + extra scene layers, max 8).
+// Each layer costs width * height * 2 bytes of heap.
+const int MATRIX_LAYER_COUNT = 4;
+// Render into a back buffer and flip on completion (tear-free animations, doubles DMA memory)
+const bool MATRIX_DOUBLE_BUFFER = false;
+
+// Text Settings
+// Most text items at a time, and the bytes their texts share (each takes its length + 1)
+const int TEXT_ITEM_CAPACITY = 16;
+const int TEXT_ARENA_SIZE = 1024;
+// Longest text item (strftime pattern and formatted text), including the terminating 0
+const int TEXT_ITEM_MAX_LENGTH = 128;
+// Scrolling text is pre-rendered into a strip of up to this many pixels (2 bytes each)
+const int MARQUEE_MAX_STRIP_PIXELS = 16384;
+
+// Render Task Settings
+// Rendering runs on the application core; WiFi and AsyncTCP stay on the protocol core (0)
+const int RENDER_TARGET_FPS = 60;
+const int RENDER_TASK_CORE = 1;
+const int RENDER_TASK_PRIORITY = 3; // above loop() (1), which handles housekeeping
+const int RENDER_TASK_STACK_SIZE = 8192;
 
 // Reset Button Settings
 const int RESET_SHORT_PRESS_TIME = 2000;
 
 // WebSocket Settings
-// Buffer size for WebSocket messages (must accommodate full image data + JSON overhead)
-// 64x32 pixels * 6 bytes per pixel (hex color) + JSON structure ≈ 12KB + overhead
-const int SOCKET_DATA_SIZE = 32768; // 32KB should be sufficient for 64x32 images
\ No newline at end of file
+// Largest JSON message accepted. Multi-packet JSON is reassembled in a buffer of the message's
+// size that only exists while it is in flight; binary image uploads are streamed straight into
+// the layers and are not limited by this.
+const int SOCKET_DATA_SIZE = 32768;
+// Decoded messages waiting for the render task (power of two). Messages arriving while it is
+// full are dropped, so it has to cover a frame's worth of chunks of a streamed image upload.
+const int COMMAND_QUEUE_SIZE = 32;
+// A scene sent with an image holds back the queue until its image is in (see CommandQueue.h).
+// If the image takes longer than this (ms), the scene is applied without waiting for it.
+const int SCENE_IMAGE_TIMEOUT = 2000;
+// Outgoing messages wait in a queue per client until the client can take them. Messages that
+// would take a client's queue past the budget are dropped; a client that takes nothing for the
+// stall timeout is closed. The budget has to fit a pixel readback (see PixelReadback.h).
+const int OUTBOX_MAX_CLIENTS = 8;
+const int OUTBOX_QUEUE_LENGTH = 16;
+const int OUTBOX_CLIENT_BUDGET = 32768;
+const unsigned long OUTBOX_STALL_TIMEOUT = 5000;
+
+// Frame Streaming Settings
+// Jitter buffer depth in frames (each width * height * 2 bytes, allocated when a stream starts)
+const int STREAM_JITTER_FRAMES = 3;
+// Default time between a frame's arrival and its presentation, to absorb network jitter
+const int STREAM_PLAYOUT_DELAY = 50;
+// A frame arriving this many ms after it was due is dropped; far later than the resync
+// threshold the sender's clock is assumed to have jumped and the stream is re-anchored
+const int STREAM_LATE_TOLERANCE = 20;
+const int STREAM_RESYNC_THRESHOLD = 500;
\ No newline at end of file
@@ -1,18 +1,32 @@
 #include "TextDisplayHandler.h"
 #include <Fonts/Picopixel.h>
+#include <utility>
 
-TextDisplayHandler::TextDisplayHandler(
-    MatrixController& matrix, TextItem* textContent, size_t textContentSize)
+TextDisplayHandler::TextDisplayHandler(MatrixController& matrix, TextItemPool& items)
     : _matrix(matrix)
-    , _textContent(textContent)
-    , _textContentSize(textContentSize)
+    , _items(items)
+    , _rendered(new RenderedItem[TEXT_ITEM_CAPACITY]())
+    , _valid(false)
+    , _layerRevision(0)
+    , _formattedTime()
+    , _hasTime(true)
 {
   strlcpy(_currentLocale, "en_US.UTF-8", sizeof(_currentLocale));
 }
 
+TextDisplayHandler::~TextDisplayHandler()
+{
+  for (size_t i = 0; i < TEXT_ITEM_CAPACITY; i++) {
+    delete _rendered[i].strip;
+  }
+  delete[] _rendered;
+}
+
 void TextDisplayHandler::setLocale(const char* locale)
 {
   strlcpy(_currentLocale, locale, sizeof(_currentLocale));
+  // Month and day names change with it
+  _valid = false;
 
   if (setlocale(LC_ALL, _currentLocale) == NULL) {
     Serial.printf("Unable to set locale %s\n", _currentLocale);
@@ -25,44 +39,317 @@ void TextDisplayHandler::setLocale(const char* locale)
   Serial.printf("Set locale to %s\n", _currentLocale);
 }
 
-void TextDisplayHandler::renderTextItem(const char* text, TextItem& item)
+const GFXfont* TextDisplayHandler::getFont(const TextItem& item) const
+{
+  return (item.font & TEXT_FONT_PICO) == 0 ? NULL : &Picopixel;
+}
+
+// Anti-aliased glyphs only exist for one size, the other sizes stay 1 bit
+const SmoothFont* TextDisplayHandler::getSmoothFont(const TextItem& item) const
+{
+  if ((item.font & TEXT_FONT_SMOOTH) == 0) {
+    return nullptr;
+  }
+  return SmoothText::find(
+      item.font & TEXT_FONT_PICO ? SmoothText::FONT_PICO : SmoothText::FONT_REGULAR, item.size);
+}
+
+TextBounds TextDisplayHandler::measureTextItem(RenderedItem& rendered)
+{
+  const TextItem& item = rendered.item;
+  if (rendered.text[0] == '\0') {
+    return {};
+  }
+
+  textPosition pos = static_cast<textPosition>(item.line);
+
+  if (item.scroll == 0) {
+    return _matrix.measureText(rendered.text, pos, getFont(item), item.size, item.offsetX,
+        item.offsetY, item.align);
+  }
+
+  // A marquee takes its rows across the whole layer
+  const TextBounds box
+      = _matrix.measureText(rendered.text, pos, getFont(item), item.size, 0, item.offsetY, 0);
+  return { 0, box.y, _matrix.getTextLayer().getLayerWidth(), box.h };
+}
+
+TextBounds TextDisplayHandler::renderTextItem(RenderedItem& rendered)
+{
+  const TextItem& item = rendered.item;
+  if (rendered.text[0] == '\0') {
+    return {};
+  }
+
+  if (item.scroll == 0) {
+    textPosition pos = static_cast<textPosition>(item.line);
+    return _matrix.drawText(rendered.text, pos, getFont(item), item.color, item.size,
+        item.offsetX, item.offsetY, item.align, getSmoothFont(item));
+  }
+
+  // The strip is shown by scrollItems(), right after
+  if (rendered.stripWidth == 0) {
+    buildStrip(rendered);
+  }
+  if (rendered.stripWidth == 0) {
+    // No strip for it, the text stays where it would start scrolling from and is cut at the edge
+    textPosition pos = static_cast<textPosition>(item.line);
+    _matrix.drawText(rendered.text, pos, getFont(item), item.color, item.size, 0, item.offsetY,
+        0, getSmoothFont(item));
+  }
+  rendered.scrollOffset = -1;
+  return measureTextItem(rendered);
+}
+
+void TextDisplayHandler::buildStrip(RenderedItem& rendered)
 {
+  const TextItem& item = rendered.item;
   textPosition pos = static_cast<textPosition>(item.line);
+  const TextBounds box
+      = _matrix.measureText(rendered.text, pos, getFont(item), item.size, 0, item.offsetY, 0);
+
+  rendered.stripWidth = 0;
+  rendered.stripHeight = 0;
+  if (box.w == 0 || box.h == 0) {
+    return;
+  }
+
+  // Only a text that doesn't fit the strip it has needs a new one
+  PixelLayer* strip = rendered.strip;
+  if (strip == nullptr || box.w > strip->getLayerWidth() || box.h > strip->getLayerHeight()) {
+    delete strip;
+    rendered.strip = nullptr;
 
-  if (item.font == 0) {
-    _matrix.drawText(
-        text, pos, NULL, item.color, item.size, item.offsetX, item.offsetY, item.align);
-  } else {
-    _matrix.drawText(
-        text, pos, &Picopixel, item.color, item.size, item.offsetX, item.offsetY, item.align);
+    if ((uint32_t)box.w * box.h > MARQUEE_MAX_STRIP_PIXELS) {
+      Serial.printf("Text too large to scroll, showing it clipped: %s\n", rendered.text);
+      return;
+    }
+    rendered.strip = new PixelLayer(box.w, box.h);
   }
+
+  rendered.strip->fillScreen(rendered.strip->transparencyColor);
+  _matrix.drawTextAt(*rendered.strip, rendered.text, getFont(item), item.color, item.size, 0, 0,
+      getSmoothFont(item));
+  rendered.stripWidth = box.w;
+  rendered.stripHeight = box.h;
+}
+
+// Moves every marquee to where it is at now. The position only depends on the time, so the
+// speed is the same whatever the frame rate; rows are only rewritten when it moved a pixel.
+void TextDisplayHandler::scrollItems(uint32_t now)
+{
+  PixelLayer& layer = _matrix.getTextLayer();
+  const int16_t width = layer.getLayerWidth();
+
+  for (size_t i = 0; i < TEXT_ITEM_CAPACITY; i++) {
+    RenderedItem& rendered = _rendered[i];
+    if (rendered.stripWidth == 0) {
+      continue;
+    }
+
+    // Enters on the right, leaves on the left, then starts over
+    const PixelLayer& strip = *rendered.strip;
+    const uint32_t travel = width + rendered.stripWidth;
+    const uint64_t moved = (uint64_t)(now - rendered.scrollStart) * rendered.item.scroll / 1000;
+    const int32_t offset = moved % travel;
+
+    if (offset == rendered.scrollOffset) {
+      continue;
+    }
+    rendered.scrollOffset = offset;
+
+    // Strip column under layer column 0, and the part of the layer the strip covers
+    const int16_t stripX = offset - width;
+    const int16_t x0 = constrain(-stripX, 0, width);
+    const int16_t x1 = constrain(rendered.stripWidth - stripX, x0, width);
+
+    // Anti-aliased text keeps its edge coverage on the way through
+    const bool withCoverage = strip.hasCoverage() && layer.enableCoverage();
+
+    for (uint16_t row = 0; row < rendered.stripHeight; row++) {
+      const int16_t y = rendered.bounds.y + row;
+      const uint8_t* coverage
+          = withCoverage ? strip.getCoverageRow(row) + stripX + x0 : nullptr;
+      layer.drawFastHLine(0, y, x0, layer.transparencyColor);
+      // Rows are little-endian RGB565 in memory, as writePixels() takes them
+      layer.writePixels(
+          x0, y, (const uint8_t*)(strip.getRow(row) + stripX + x0), x1 - x0, coverage);
+      layer.drawFastHLine(x1, y, width - x1, layer.transparencyColor);
+    }
+  }
+}
+
+// Removing an item moves the later ones down in the pool, what was drawn for them moves along so
+// only the removed one looks changed
+void TextDisplayHandler::matchItems()
+{
+  for (size_t i = 0; i < _items.count(); i++) {
+    const uint16_t id = _items.getId(i);
+    if (_rendered[i].id == id) {
+      continue;
+    }
+
+    for (size_t j = i + 1; j < TEXT_ITEM_CAPACITY; j++) {
+      if (_rendered[j].id == id) {
+        std::swap(_rendered[i], _rendered[j]);
+        break;
+      }
+    }
+  }
+}
+
+static bool intersects(const TextBounds& a, const TextBounds& b)
+{
+  return a.w > 0 && a.h > 0 && b.w > 0 && b.h > 0 && a.x < b.x + b.w && b.x < a.x + a.w
+      && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+static bool sameSecond(const struct tm& a, const struct tm& b)
+{
+  return a.tm_sec == b.tm_sec && a.tm_min == b.tm_min && a.tm_hour == b.tm_hour
+      && a.tm_mday == b.tm_mday && a.tm_mon == b.tm_mon && a.tm_year == b.tm_year;
+}
+
+void TextDisplayHandler::clearBounds(const TextBounds& bounds)
+{
+  PixelLayer& layer = _matrix.getTextLayer();
+  for (int16_t y = bounds.y; y < bounds.y + bounds.h; y++) {
+    layer.drawFastHLine(bounds.x, y, bounds.w, layer.transparencyColor);
+  }
+}
+
+// Besides the changed items, every item overlapping a box that gets cleared has to be redrawn,
+// and so on, until the redrawn boxes look exactly as after a full redraw. Returns false if
+// nothing changed.
+bool TextDisplayHandler::markRedraws()
+{
+  bool any = false;
+  bool grown = true;
+
+  for (size_t i = 0; i < TEXT_ITEM_CAPACITY; i++) {
+    any |= _rendered[i].redraw;
+  }
+
+  while (any && grown) {
+    grown = false;
+    for (size_t i = 0; i < TEXT_ITEM_CAPACITY; i++) {
+      RenderedItem& item = _rendered[i];
+      if (item.redraw) {
+        continue;
+      }
+
+      for (size_t j = 0; j < TEXT_ITEM_CAPACITY; j++) {
+        const RenderedItem& other = _rendered[j];
+        if (other.redraw
+            && (intersects(item.bounds, other.bounds)
+                || intersects(item.bounds, other.oldBounds))) {
+          item.redraw = true;
+          grown = true;
+          break;
+        }
+      }
+    }
+  }
+
+  return any;
 }
 
 void TextDisplayHandler::renderText()
 {
   struct tm timeinfo;
 
-  if (!getLocalTime(&timeinfo)) {
-    Serial.println("Failed to obtain time");
+  // Never wait for NTP here, this runs on the frame clock
+  if (!getLocalTime(&timeinfo, 0)) {
+    if (_hasTime) {
+      Serial.println("Failed to obtain time");
+      _hasTime = false;
+    }
     return;
   }
+  _hasTime = true;
+
+  const uint32_t now = millis();
+  PixelLayer& layer = _matrix.getTextLayer();
+  const bool full = !_valid || layer.getRevision() != _layerRevision;
+  // The formatted text can't change within a second
+  const bool newSecond = full || !sameSecond(timeinfo, _formattedTime);
+
+  matchItems();
 
-  _matrix.getTextLayer().clear();
+  for (size_t i = 0; i < TEXT_ITEM_CAPACITY; i++) {
+    RenderedItem& rendered = _rendered[i];
+    // Slots past the last item show nothing, as an item without text would
+    const bool exists = i < _items.count();
+    const uint16_t id = exists ? _items.getId(i) : 0;
+    const TextItem style = exists ? _items.getStyle(i) : TextItem {};
+    const char* format = exists ? _items.getText(i) : "";
+    const bool itemChanged = rendered.id != id
+        || memcmp(&rendered.item, &style, sizeof(TextItem)) != 0
+        || strcmp(rendered.format, format) != 0;
 
-  for (size_t i = 0; i < _textContentSize; i++) {
-    if (_textContent[i].text[0] == '\0') {
-      // Skip empty text items
+    rendered.oldBounds = rendered.bounds;
+    rendered.redraw = full;
+
+    if (!full && !itemChanged && !newSecond) {
       continue;
     }
 
-    char parsedDate[32];
-    strftime(parsedDate, 32, _textContent[i].text, &timeinfo);
-    renderTextItem(parsedDate, _textContent[i]);
+    char parsedDate[TEXT_ITEM_MAX_LENGTH] = "";
+    if (format[0] != '\0') {
+      strftime(parsedDate, sizeof(parsedDate), format, &timeinfo);
+    }
+
+    const bool textChanged = strcmp(parsedDate, rendered.text) != 0;
+    if (full || itemChanged || textChanged) {
+      // A marquee renders new text into its strip but keeps moving (a scrolling clock ticks),
+      // it only starts over when the item itself changed. Items that stop scrolling let the
+      // strip go.
+      if (itemChanged || textChanged) {
+        rendered.stripWidth = 0;
+        rendered.stripHeight = 0;
+      }
+      if (style.scroll == 0 && rendered.strip != nullptr) {
+        delete rendered.strip;
+        rendered.strip = nullptr;
+      }
+      if (itemChanged) {
+        rendered.scrollStart = now;
+      }
+
+      rendered.id = id;
+      rendered.item = style;
+      strlcpy(rendered.format, format, sizeof(rendered.format));
+      strlcpy(rendered.text, parsedDate, sizeof(rendered.text));
+      rendered.bounds = measureTextItem(rendered);
+      rendered.redraw = true;
+    }
   }
-}
 
-TextItem* TextDisplayHandler::getTextContent() { return _textContent; }
+  _formattedTime = timeinfo;
+
+  if (full) {
+    layer.clear();
+  } else if (markRedraws()) {
+    for (size_t i = 0; i < TEXT_ITEM_CAPACITY; i++) {
+      if (_rendered[i].redraw) {
+        clearBounds(_rendered[i].oldBounds);
+        clearBounds(_rendered[i].bounds);
+      }
+    }
+  }
 
-size_t TextDisplayHandler::getTextContentSize() const { return _textContentSize; }
+  // In item order, later items are drawn over earlier ones as before
+  for (size_t i = 0; i < TEXT_ITEM_CAPACITY; i++) {
+    RenderedItem& rendered = _rendered[i];
+    if (rendered.redraw) {
+      rendered.bounds = renderTextItem(rendered);
+    }
+  }
+
+  scrollItems(now);
+
+  _layerRevision = layer.getRevision();
+  _valid = true;
+}
 
 const char* TextDisplayHandler::getCurrentLocale() const { return _currentLocale; }
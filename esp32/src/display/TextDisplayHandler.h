@@ -7,24 +7,70 @@
 
 #include "../matrix/MatrixController.h"
 #include "../types/CommonTypes.h"
+#include "TextItemPool.h"
 
+/**
+ * Renders the text items of a TextItemPool (clock, dates, custom lines) into the text layer.
+ *
+ * renderText() runs every frame but only touches the layer when an item's formatted text,
+ * style or position changed, and then only redraws the boxes involved. The layer's revision
+ * tells whether anyone else drew into it meanwhile (clear, reset screen), which forces a full
+ * redraw. What was drawn for an item follows it by id when removing another one moves it down.
+ *
+ * Items with a scroll speed run as a marquee: the formatted text is rendered once into an
+ * off-screen strip, and every frame that the time-based position moves on a pixel, the strip is
+ * copied through a window as wide as the layer. A scrolling item owns its rows across the whole
+ * layer, anything overlapping them is drawn over. The strip is reused for new text that fits
+ * it; text too large for any strip (MARQUEE_MAX_STRIP_PIXELS) stands still, cut at the edge.
+ */
 class TextDisplayHandler {
   public:
-  TextDisplayHandler(MatrixController& matrix, TextItem* textContent, size_t textContentSize);
+  TextDisplayHandler(MatrixController& matrix, TextItemPool& items);
+  ~TextDisplayHandler();
 
   void setLocale(const char* locale);
   void renderText();
 
-  TextItem* getTextContent();
-  size_t getTextContentSize() const;
   const char* getCurrentLocale() const;
 
   private:
-  void renderTextItem(const char* text, TextItem& item);
+  // What was last drawn for a text item
+  struct RenderedItem {
+    uint16_t id; // 0 if no item was drawn
+    TextItem item;
+    char format[TEXT_ITEM_MAX_LENGTH];
+    char text[TEXT_ITEM_MAX_LENGTH]; // formatted
+    TextBounds bounds;
+    TextBounds oldBounds; // before this renderText()
+    bool redraw;
+    // Marquee: the pre-rendered text, when it started moving and the position last shown. The
+    // strip stays allocated while the item scrolls, the text takes its top left stripWidth x
+    // stripHeight pixels (0 until it has been rendered).
+    PixelLayer* strip;
+    uint16_t stripWidth;
+    uint16_t stripHeight;
+    uint32_t scrollStart;
+    int32_t scrollOffset; // -1 until the strip has been shown
+  };
+
+  const GFXfont* getFont(const TextItem& item) const;
+  const SmoothFont* getSmoothFont(const TextItem& item) const;
+  TextBounds measureTextItem(RenderedItem& rendered);
+  TextBounds renderTextItem(RenderedItem& rendered);
+  void clearBounds(const TextBounds& bounds);
+  bool markRedraws();
+  void buildStrip(RenderedItem& rendered);
+  void scrollItems(uint32_t now);
+  void matchItems();
 
   MatrixController& _matrix;
-  TextItem* _textContent;
-  size_t _textContentSize;
+  TextItemPool& _items;
+  RenderedItem* _rendered; // TEXT_ITEM_CAPACITY, in the pool's order
+  bool _valid;
+  // Text layer revision right after the last renderText() drew, and the second it formatted
+  uint32_t _layerRevision;
+  struct tm _formattedTime;
+  bool _hasTime;
   char _currentLocale[32];
 };
 
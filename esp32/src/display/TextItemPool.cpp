@@ -0,0 +1,138 @@
+#include "TextItemPool.h"
+
+TextItemPool::TextItemPool()
+    : _count(0)
+    , _arenaUsed(1)
+{
+  // Byte 0 is the empty text all items without one point to
+  _arena[0] = '\0';
+}
+
+uint16_t TextItemPool::set(uint16_t id, const char* text, const TextItem& style)
+{
+  const int index = id != 0 ? find(id) : -1;
+
+  if (index >= 0) {
+    Entry& entry = _entries[index];
+    if (text != nullptr && !storeText(entry, text)) {
+      return 0;
+    }
+    entry.style = style;
+    return entry.id;
+  }
+
+  if (_count >= TEXT_ITEM_CAPACITY) {
+    return 0;
+  }
+  if (id == 0) {
+    id = 1;
+    while (find(id) >= 0) {
+      id++;
+    }
+  }
+
+  Entry& entry = _entries[_count];
+  entry.id = id;
+  entry.style = style;
+  entry.offset = 0;
+  entry.capacity = 0;
+  if (text != nullptr && !storeText(entry, text)) {
+    return 0;
+  }
+
+  _count++;
+  return id;
+}
+
+bool TextItemPool::remove(uint16_t id)
+{
+  const int index = find(id);
+  if (index < 0) {
+    return false;
+  }
+
+  // Later items move down to keep the drawing order, the text's space is reclaimed by compact()
+  memmove(&_entries[index], &_entries[index + 1], (_count - index - 1) * sizeof(Entry));
+  _count--;
+  return true;
+}
+
+void TextItemPool::clear()
+{
+  _count = 0;
+  _arenaUsed = 1;
+}
+
+int TextItemPool::find(uint16_t id) const
+{
+  for (size_t i = 0; i < _count; i++) {
+    if (_entries[i].id == id) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+bool TextItemPool::storeText(Entry& entry, const char* text)
+{
+  const uint16_t length = strnlen(text, TEXT_ITEM_MAX_LENGTH - 1);
+
+  if (length < entry.capacity) {
+    memcpy(_arena + entry.offset, text, length);
+    _arena[entry.offset + length] = '\0';
+    return true;
+  }
+
+  // Everything the other items hold has to stay
+  uint16_t live = 1;
+  for (size_t i = 0; i < _count; i++) {
+    if (&_entries[i] != &entry) {
+      live += _entries[i].capacity;
+    }
+  }
+  if (live + length + 1 > TEXT_ARENA_SIZE) {
+    return false;
+  }
+
+  entry.offset = 0;
+  entry.capacity = 0;
+  if (length == 0) {
+    return true;
+  }
+  if (_arenaUsed + length + 1 > TEXT_ARENA_SIZE) {
+    compact();
+  }
+
+  entry.offset = _arenaUsed;
+  entry.capacity = length + 1;
+  memcpy(_arena + entry.offset, text, length);
+  _arena[entry.offset + length] = '\0';
+  _arenaUsed += entry.capacity;
+  return true;
+}
+
+// Moves the texts down over the gaps, in arena order so each one only ever moves down
+void TextItemPool::compact()
+{
+  uint16_t used = 1;
+
+  while (true) {
+    Entry* next = nullptr;
+    for (size_t i = 0; i < _count; i++) {
+      Entry& entry = _entries[i];
+      if (entry.capacity > 0 && entry.offset >= used
+          && (next == nullptr || entry.offset < next->offset)) {
+        next = &entry;
+      }
+    }
+    if (next == nullptr) {
+      break;
+    }
+
+    memmove(_arena + used, _arena + next->offset, next->capacity);
+    next->offset = used;
+    used += next->capacity;
+  }
+
+  _arenaUsed = used;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "../config/settings.h"
+#include "../types/CommonTypes.h"
+#include <Arduino.h>
+
+/**
+ * TextItemPool - The text items, in drawing order
+ *
+ * Up to TEXT_ITEM_CAPACITY items, each with an id that stays the same while it exists, so a
+ * single item can be changed or removed without sending the whole list. Texts are kept in one
+ * fixed arena of TEXT_ARENA_SIZE bytes and take only the space they need; a text that no longer
+ * fits where it was moves to the end, and the arena is compacted when the end is reached.
+ * Nothing is allocated after construction.
+ *
+ * Text pointers are only valid until the next change. Only used from the render task.
+ */
+class TextItemPool {
+  public:
+  TextItemPool();
+
+  // Adds an item, or changes the one with this id in place. id 0 takes the lowest unused id.
+  // text nullptr keeps the current text (empty for a new item), longer texts are cut at
+  // TEXT_ITEM_MAX_LENGTH - 1 bytes and must not point into the pool. Returns the id, 0 if the
+  // pool or the arena is full.
+  uint16_t set(uint16_t id, const char* text, const TextItem& style);
+  bool remove(uint16_t id);
+  void clear();
+
+  size_t count() const { return _count; }
+  // Index of the item with this id, -1 if there is none
+  int find(uint16_t id) const;
+
+  // By index, 0..count() - 1
+  uint16_t getId(size_t index) const { return _entries[index].id; }
+  const TextItem& getStyle(size_t index) const { return _entries[index].style; }
+  const char* getText(size_t index) const { return _arena + _entries[index].offset; }
+
+  private:
+  struct Entry {
+    uint16_t id;
+    TextItem style;
+    uint16_t offset; // text in _arena, 0 terminated
+    uint16_t capacity; // bytes reserved there
+  };
+
+  bool storeText(Entry& entry, const char* text);
+  void compact();
+
+  Entry _entries[TEXT_ITEM_CAPACITY];
+  size_t _count;
+  char _arena[TEXT_ARENA_SIZE];
+  uint16_t _arenaUsed; // from the start, including space left by moved texts
+};
@@ -21,12 +21,16 @@
 #include "config/settings.h"
 #include "data/CustomDataHandler.h"
 #include "display/TextDisplayHandler.h"
+#include "display/TextItemPool.h"
 #include "input/ResetButtonHandler.h"
 #include "matrix/MatrixController.h"
 #include "ota/OTAUpdateHandler.h"
+#include "render/RenderTask.h"
 #include "server/WebServerHandler.h"
 #include "types/CommonTypes.h"
 #include "utils/utils.h"
+#include "websocket/ActionRegistry.h"
+#include "websocket/Outbox.h"
 #include "websocket/WebSocketHandler.h"
 #include "wifi/WiFiConnectionHandler.h"
 
@@ -39,7 +43,9 @@ ConfigManager& config = ConfigManager::getInstance();
 
 MatrixController matrix;
 
-bool startupFinished = false;
+// The IP address is shown for this long after boot before the clock takes over
+const unsigned long STARTUP_SCREEN_DURATION = 6000;
+unsigned long startupScreenUntil = 0;
 
 // clock options - to be migrated to state manager
 boolean showText = true;
@@ -49,11 +55,7 @@ boolean forceUpdateTime = false;
 // Mutable copies for runtime configuration
 char currentTimezone[64];
 
-TextItem textContent[5]
-    = { { "%H:%M", 0xFFFF, -1, -5, 1, 2, 1 }, { "%d.%b", 0xFFFF, 2, -3, 1, 1, 2 } };
-
-char* socketData;
-int currSocketBufferIndex = 0;
+TextItemPool textItems;
 
 // custom data - kept for WebSocketHandler access
 int customDataUpdateInterval = -1;
@@ -68,11 +70,11 @@ AsyncWebServer server(80);
 AsyncWebSocket ws("/ws");
 WiFiConnectionHandler wifiHandler(server);
 ResetButtonHandler resetButton(RESET_PIN, RESET_SHORT_PRESS_TIME);
-TextDisplayHandler textDisplay(matrix, textContent, 5);
+TextDisplayHandler textDisplay(matrix, textItems);
 WebServerHandler webServer(server, ws);
 CustomDataHandler customData;
 
-void initMatrix() { matrix.begin(); }
+void initMatrix() { matrix.begin(MATRIX_DOUBLE_BUFFER); }
 
 void onEvent(AsyncWebSocket* server, AsyncWebSocketClient* client, AwsEventType type, void* arg,
     uint8_t* data, size_t len)
@@ -85,7 +87,7 @@ void onEvent(AsyncWebSocket* server, AsyncWebSocketClient* client, AwsEventType
     WebSocketHandler::onDisconnect(client);
     break;
   case WS_EVT_DATA:
-    WebSocketHandler::handleMessage(arg, data, len);
+    WebSocketHandler::handleMessage(client, arg, data, len);
     break;
   case WS_EVT_PONG:
     break;
@@ -103,8 +105,7 @@ void initWebSocket()
   server.addHandler(&ws);
   ws.enable(true);
 
-  WebSocketHandler::init(&matrix, textContent, &ws, socketData, &currSocketBufferIndex,
-      SOCKET_DATA_SIZE, &textDisplay, &customData);
+  WebSocketHandler::init(&matrix, &textItems, &ws, SOCKET_DATA_SIZE, &textDisplay, &customData);
 }
 
 void checkHeapAndLog()
@@ -124,6 +125,34 @@ void checkHeapAndLog()
   Serial.printf("WiFi Status: %s (RSSI: %d dBm)\n",
       wifiHandler.isConnected() ? "Connected" : "Disconnected", wifiHandler.getRSSI());
   Serial.printf("WebSocket Clients: %u\n", ws.count());
+  Serial.printf("Pixels pushed last frame: %u\n", matrix.getPixelsPushed());
+
+  RenderTask::Stats renderStats = RenderTask::getStats();
+  Serial.printf("Render: %u frames, %u overruns, last %u us, max %u us (target %u fps)\n",
+      renderStats.frames, renderStats.overruns, renderStats.lastFrameMicros,
+      renderStats.maxFrameMicros, renderStats.targetFps);
+  CommandQueue::Stats queueStats = WebSocketHandler::getCommandQueueStats();
+  Serial.printf("Command queue: %u waiting, max %u, %u dropped, %u coalesced\n",
+      queueStats.depth, queueStats.maxDepth, queueStats.dropped, queueStats.coalesced);
+  Outbox::Stats outboxStats = Outbox::getStats();
+  Serial.printf("Outbox: max %u bytes / %u messages queued per client, %u dropped, %u coalesced, "
+                "%u clients shed\n",
+      outboxStats.maxQueuedBytes, outboxStats.maxQueuedMessages, outboxStats.dropped,
+      outboxStats.coalesced, outboxStats.shed);
+  FrameStream::Stats streamStats = WebSocketHandler::getFrameStreamStats();
+  if (streamStats.received > 0) {
+    Serial.printf("Stream: %u received, %u presented, %u late, %u overflow, %u resyncs\n",
+        streamStats.received, streamStats.presented, streamStats.late, streamStats.overflow,
+        streamStats.resyncs);
+  }
+  for (uint8_t i = 0; i < ActionRegistry::getCount(); i++) {
+    const ActionRegistry::Action& action = ActionRegistry::getAction(i);
+    if (action.stats.calls > 0) {
+      Serial.printf("Action %s: %u calls, %u errors, %llu us total, max %u us\n", action.name,
+          action.stats.calls, action.stats.errors, action.stats.totalMicros,
+          action.stats.maxMicros);
+    }
+  }
   Serial.printf("Uptime: %lu seconds\n", millis() / 1000);
   Serial.println("====================");
 
@@ -133,6 +162,29 @@ void checkHeapAndLog()
   }
 }
 
+// Runs on the render task once per frame
+void renderFrame()
+{
+  // WebSocket messages received since the last frame
+  WebSocketHandler::applyCommands();
+
+  if (millis() < startupScreenUntil) {
+    // Keep showing the IP address
+  } else if (resetButton.isPressed()) {
+    char resetTimeString[16];
+    itoa(resetButton.getPressDuration(), resetTimeString, 10);
+    matrix.getTextLayer().clear();
+    matrix.getTextLayer().setCursor(0, 0);
+    matrix.getTextLayer().println("Reset");
+    matrix.getTextLayer().setCursor(0, 16);
+    matrix.getTextLayer().println(resetTimeString);
+  } else if (showText == true) {
+    textDisplay.renderText();
+  }
+
+  matrix.render(config.getCompositionMode());
+}
+
 void setup()
 {
   Serial.begin(115200);
@@ -141,10 +193,11 @@ void setup()
   // Initialize ConfigManager first
   config.begin();
 
-  // Initialize text display with locale from config
+  // Initialize text display with locale from config, showing time and date until the app sends
+  // its own text
   textDisplay.setLocale(config.getLocale());
-
-  socketData = (char*)malloc(SOCKET_DATA_SIZE * sizeof(char));
+  textItems.set(0, "%H:%M", { 0xFFFF, -1, -5, 1, 2, 1 });
+  textItems.set(0, "%d.%b", { 0xFFFF, 2, -3, 1, 1, 2 });
 
   // Initialize reset button
   resetButton.begin();
@@ -163,6 +216,13 @@ void setup()
   matrix.setBrightness(config.getBrightness());
   Serial.printf("Set initial brightness to %d\n", config.getBrightness());
 
+  // Show the IP address until the startup screen times out
+  const String ip = wifiHandler.getIPAddress();
+  matrix.drawText(ip.c_str(), MIDDLE, &Picopixel, 0xFFFF, 1, 0, 0, 1);
+  startupScreenUntil = millis() + STARTUP_SCREEN_DURATION;
+
+  RenderTask::begin(renderFrame, RENDER_TARGET_FPS);
+
   // Initialize WebSocket and Web Server
   initWebSocket();
   webServer.begin();
@@ -172,37 +232,17 @@ void setup()
   Serial.printf("Configured NTP: %s, Timezone: %s\n", config.getNtpServer(), config.getTimezone());
 }
 
+// Housekeeping - rendering happens on the render task
 void loop()
 {
   wifiHandler.loop();
   resetButton.update();
 
-  if (startupFinished == false) {
-    const String ip = wifiHandler.getIPAddress();
-
-    matrix.drawText(ip.c_str(), MIDDLE, &Picopixel, 0xFFFF, 1, 0, 0, 1);
-    matrix.render(config.getCompositionMode());
-
-    delay(6000);
-
-    startupFinished = true;
-  } else if (resetButton.isPressed()) {
-    char resetTimeString[16];
-    itoa(resetButton.getPressDuration(), resetTimeString, 10);
-    matrix.getTextLayer().clear();
-    matrix.getTextLayer().setCursor(0, 0);
-    matrix.getTextLayer().println("Reset");
-    matrix.getTextLayer().setCursor(0, 16);
-    matrix.getTextLayer().println(resetTimeString);
-  } else if (showText == true) {
-    textDisplay.renderText();
-  }
-
   customData.update();
 
   ws.cleanupClients();
-
-  matrix.render(config.getCompositionMode());
+  // Retries clients that could not take their messages yet, and sheds the stalled ones
+  Outbox::flush();
 
   if (millis() - lastHeapCheck > 300000) {
     lastHeapCheck = millis();
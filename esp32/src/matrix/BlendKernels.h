@@ -0,0 +1,81 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * SWAR blend kernels for RGB565
+ *
+ * A 565 pixel is spread across a 32 bit word as 00000gggggg00000rrrrr000000bbbbb, which leaves
+ * guard bits above every channel. One integer multiply then scales all three channels at once
+ * and per-channel overflow lands in the guard bits, where it can be detected and saturated
+ * without branches. The compositor keeps its accumulator in this form across the whole layer
+ * stack and only packs it back to 565 once per pixel.
+ *
+ * Opacity is applied as a 5 bit alpha (0..32), the precision the 5 bit channels can resolve.
+ */
+namespace BlendKernels {
+
+static constexpr uint32_t CHANNEL_MASK = 0x07E0F81F;
+// Lowest guard bit above each channel (green 27, red 16, blue 5)
+static constexpr uint32_t OVERFLOW_GREEN = 1UL << 27;
+static constexpr uint32_t OVERFLOW_RED_BLUE = (1UL << 16) | (1UL << 5);
+
+inline uint32_t expand(uint16_t color) { return (color | ((uint32_t)color << 16)) & CHANNEL_MASK; }
+
+inline uint16_t pack(uint32_t expanded) { return (uint16_t)((expanded >> 16) | expanded); }
+
+// 0..255 opacity to the 0..32 alpha used by the kernels
+inline uint8_t opacityToAlpha(uint8_t opacity) { return (opacity + 4) >> 3; }
+
+// below + (above - below) * alpha / 32 for all channels with one multiply
+inline uint32_t mix(uint32_t below, uint32_t above, uint8_t alpha)
+{
+  return ((((above - below) * alpha) >> 5) + below) & CHANNEL_MASK;
+}
+
+inline uint32_t normal(uint32_t below, uint32_t above, uint8_t alpha)
+{
+  return alpha >= 32 ? above : mix(below, above, alpha);
+}
+
+// Saturating per-channel add of the alpha scaled layer
+inline uint32_t add(uint32_t below, uint32_t above, uint8_t alpha)
+{
+  const uint32_t scaled = alpha >= 32 ? above : ((above * alpha) >> 5) & CHANNEL_MASK;
+  const uint32_t sum = below + scaled;
+
+  // Turn each overflow bit into an all-ones channel (6 bits for green, 5 for red and blue)
+  const uint32_t overflowGreen = sum & OVERFLOW_GREEN;
+  const uint32_t overflowRedBlue = sum & OVERFLOW_RED_BLUE;
+  const uint32_t saturate
+      = (overflowGreen - (overflowGreen >> 6)) | (overflowRedBlue - (overflowRedBlue >> 5));
+
+  return (sum | saturate) & CHANNEL_MASK;
+}
+
+// a * b / 31 and a * b / 63, rounded to nearest without a division (exact for every input)
+inline uint32_t multiply5(uint32_t a, uint32_t b)
+{
+  const uint32_t t = a * b + 16;
+  return (t + (t >> 5)) >> 5;
+}
+
+inline uint32_t multiply6(uint32_t a, uint32_t b)
+{
+  const uint32_t t = a * b + 32;
+  return (t + (t >> 6)) >> 6;
+}
+
+// below * above / max per channel; the channels are multiplied separately as their products
+// do not fit the guard bits, the opacity mix is shared
+inline uint32_t multiply(uint32_t below, uint32_t above, uint8_t alpha)
+{
+  const uint32_t red = multiply5((below >> 11) & 0x1F, (above >> 11) & 0x1F) << 11;
+  const uint32_t green = multiply6((below >> 21) & 0x3F, (above >> 21) & 0x3F) << 21;
+  const uint32_t blue = multiply5(below & 0x1F, above & 0x1F);
+  const uint32_t product = red | green | blue;
+
+  return alpha >= 32 ? product : mix(below, product, alpha);
+}
+
+} // namespace BlendKernels
@@ -0,0 +1,28 @@
+#include "ColorLut.h"
+#include <math.h>
+
+// Level of one channel step in 8.4 fixed point. Any nonzero input keeps at least one fraction
+// step so dithering can still show it.
+static uint16_t channelLevel(uint8_t value, uint8_t maxValue, float gamma, uint16_t scale)
+{
+  if (value == 0) {
+    return 0;
+  }
+
+  const float fullScale = 255 << ColorLut::FRACTION_BITS;
+  const float level = powf((float)value / maxValue, gamma) * fullScale * scale / 256;
+  return constrain((uint16_t)lroundf(level), 1, (uint16_t)fullScale);
+}
+
+void ColorLut::build(float gamma, uint16_t scale)
+{
+  scale = min<uint16_t>(scale, 256);
+
+  for (uint8_t i = 0; i < 32; i++) {
+    _red[i] = channelLevel(i, 31, gamma, scale);
+    _blue[i] = _red[i];
+  }
+  for (uint8_t i = 0; i < 64; i++) {
+    _green[i] = channelLevel(i, 63, gamma, scale);
+  }
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "../config/settings.h"
+#include <Arduino.h>
+
+// RGB565 <-> RGB888 helpers, using the same rounding as the GFX_Layer conversion
+inline uint8_t expand5To8(uint8_t value) { return ((value * 527) + 23) >> 6; }
+inline uint8_t expand6To8(uint8_t value) { return ((value * 259) + 33) >> 6; }
+
+inline void color565To888(uint16_t color, uint8_t& r, uint8_t& g, uint8_t& b)
+{
+  r = expand5To8((color >> 11) & 0x1F);
+  g = expand6To8((color >> 5) & 0x3F);
+  b = expand5To8(color & 0x1F);
+}
+
+inline uint16_t color888To565(uint8_t r, uint8_t g, uint8_t b)
+{
+  return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+}
+
+/**
+ * ColorLut - Gamma and brightness tables expanding RGB565 channels to the 8 bit DMA values
+ *
+ * Layers stay in 565 all the way through composition; this is the only place colors are
+ * widened. The tables fold gamma and software dimming into 8.4 fixed point values and are only
+ * rebuilt when brightness changes, so a pushed pixel costs a lookup, an add and a shift.
+ *
+ * The 4 fraction bits are what dark shades lose to gamma. With dithering the caller passes a
+ * 0..15 threshold that changes every frame; the fraction then shows up as the share of frames
+ * a pixel is rounded up, which the eye averages into the missing in-between levels.
+ */
+class ColorLut {
+  public:
+  static const uint8_t FRACTION_BITS = 4;
+  static const uint8_t DITHER_LEVELS = 1 << FRACTION_BITS;
+
+  ColorLut() { build(DISPLAY_GAMMA, 256); }
+
+  // scale is the software dimming factor in 1/256 steps (256 = full output)
+  void build(float gamma, uint16_t scale);
+
+  inline uint8_t red(uint16_t color) const { return _red[color >> 11] >> FRACTION_BITS; }
+  inline uint8_t green(uint16_t color) const
+  {
+    return _green[(color >> 5) & 0x3F] >> FRACTION_BITS;
+  }
+  inline uint8_t blue(uint16_t color) const { return _blue[color & 0x1F] >> FRACTION_BITS; }
+
+  // Dithered variants, threshold in 0..DITHER_LEVELS-1. Table values top out at 255 << 4, so
+  // the sum never leaves 8 bits after the shift.
+  inline uint8_t red(uint16_t color, uint8_t threshold) const
+  {
+    return (_red[color >> 11] + threshold) >> FRACTION_BITS;
+  }
+  inline uint8_t green(uint16_t color, uint8_t threshold) const
+  {
+    return (_green[(color >> 5) & 0x3F] + threshold) >> FRACTION_BITS;
+  }
+  inline uint8_t blue(uint16_t color, uint8_t threshold) const
+  {
+    return (_blue[color & 0x1F] + threshold) >> FRACTION_BITS;
+  }
+
+  // Ordered dither threshold for a pixel. Every frame shifts all thresholds by an odd step, so
+  // each pixel cycles through all 16 of them while neighbours stay spread out.
+  static inline uint8_t ditherThreshold(int16_t x, int16_t y, uint32_t frame)
+  {
+    static const uint8_t bayer[4][4] = {
+      { 0, 8, 2, 10 },
+      { 12, 4, 14, 6 },
+      { 3, 11, 1, 9 },
+      { 15, 7, 13, 5 },
+    };
+    return (bayer[y & 3][x & 3] + frame * 7) & (DITHER_LEVELS - 1);
+  }
+
+  private:
+  uint16_t _red[32];
+  uint16_t _green[64];
+  uint16_t _blue[32];
+};
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "../config/pins.h"
+#include <Arduino.h>
+
+/**
+ * DisplayGeometry - Maps the virtual display onto the physical panel chain
+ *
+ * Everything above the DMA boundary (layers, handlers, text layout, readback) works in virtual
+ * coordinates of DISPLAY_WIDTH x DISPLAY_HEIGHT. The driver sees one long row of PANEL_CHAIN
+ * panels, so only the row writer has to translate, one tile-aligned run at a time.
+ */
+namespace DisplayGeometry {
+const uint16_t DISPLAY_WIDTH = PANEL_WIDTH * PANEL_TILE_COLS;
+const uint16_t DISPLAY_HEIGHT = PANEL_HEIGHT * PANEL_TILE_ROWS;
+
+// Tiles in serpentine odd rows are rotated by 180 degrees
+inline bool isFlipped(int16_t y) { return PANEL_SERPENTINE && ((y / PANEL_HEIGHT) & 1); }
+
+// Pixels of [x, x + count) that fall into the same tile as x
+inline int16_t tileSpan(int16_t x, int16_t count)
+{
+  return min<int16_t>(count, PANEL_WIDTH - x % PANEL_WIDTH);
+}
+
+// Virtual -> chain coordinates
+inline void toChain(int16_t x, int16_t y, int16_t& chainX, int16_t& chainY)
+{
+  const int16_t tileRow = y / PANEL_HEIGHT;
+  int16_t tileCol = x / PANEL_WIDTH;
+  int16_t localX = x % PANEL_WIDTH;
+  int16_t localY = y % PANEL_HEIGHT;
+
+  if (isFlipped(y)) {
+    tileCol = PANEL_TILE_COLS - 1 - tileCol;
+    localX = PANEL_WIDTH - 1 - localX;
+    localY = PANEL_HEIGHT - 1 - localY;
+  }
+
+  chainX = (tileRow * PANEL_TILE_COLS + tileCol) * PANEL_WIDTH + localX;
+  chainY = localY;
+}
+} // namespace DisplayGeometry
@@ -0,0 +1,202 @@
+#include "GlyphAtlas.h"
+
+// Collects what GFX draws for one glyph of the built-in font, whose data GFX keeps to itself
+class GlyphRecorder : public GFX {
+  public:
+  GlyphRecorder()
+      : GFX(8, 8)
+  {
+  }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override
+  {
+    if (x >= 0 && x < 8 && y >= 0 && y < 8 && color != 0) {
+      rows[y] |= 1 << x;
+    }
+  }
+
+  uint8_t rows[8];
+};
+
+const GlyphAtlas* GlyphAtlas::get(const GFXfont* font)
+{
+  static GlyphAtlas* atlases[MAX_FONTS] = {};
+
+  for (GlyphAtlas*& atlas : atlases) {
+    if (atlas == nullptr) {
+      atlas = new GlyphAtlas(font);
+      return atlas;
+    }
+    if (atlas->_font == font) {
+      return atlas;
+    }
+  }
+
+  // More fonts than expected, the last slot is rebuilt for each new one
+  GlyphAtlas*& last = atlases[MAX_FONTS - 1];
+  delete last;
+  last = new GlyphAtlas(font);
+  return last;
+}
+
+GlyphAtlas::GlyphAtlas(const GFXfont* font)
+    : _font(font)
+    , _first(FIRST_CHAR)
+    , _last(LAST_CHAR)
+    , _complete(true)
+{
+  memset(_glyphs, 0, sizeof(_glyphs));
+
+  if (font == nullptr) {
+    buildBuiltin();
+  } else {
+    buildFont(font);
+  }
+}
+
+void GlyphAtlas::buildBuiltin()
+{
+  GlyphRecorder recorder;
+
+  for (uint8_t c = FIRST_CHAR; c <= LAST_CHAR; c++) {
+    Glyph& glyph = _glyphs[c - FIRST_CHAR];
+    memset(recorder.rows, 0, sizeof(recorder.rows));
+    recorder.drawChar(0, 0, c, 0xFFFF, 0xFFFF, 1);
+
+    memcpy(glyph.rows, recorder.rows, sizeof(glyph.rows));
+    glyph.width = 5;
+    glyph.height = 8;
+    glyph.xAdvance = 6;
+  }
+}
+
+void GlyphAtlas::buildFont(const GFXfont* font)
+{
+  _first = max<uint16_t>(FIRST_CHAR, font->first);
+  _last = min<uint16_t>(LAST_CHAR, font->last);
+
+  for (uint16_t c = _first; c <= _last; c++) {
+    const GFXglyph& source = font->glyph[c - font->first];
+    Glyph& glyph = _glyphs[c - FIRST_CHAR];
+
+    if (source.width > MAX_GLYPH_SIZE || source.height > MAX_GLYPH_SIZE) {
+      _complete = false;
+      return;
+    }
+
+    glyph.xOffset = source.xOffset;
+    glyph.yOffset = source.yOffset;
+    glyph.width = source.width;
+    glyph.height = source.height;
+    glyph.xAdvance = source.xAdvance;
+
+    // Glyph bitmaps are packed MSB first without row padding, as GFX reads them
+    const uint8_t* bitmap = font->bitmap + source.bitmapOffset;
+    uint8_t bits = 0;
+    uint16_t bit = 0;
+    for (uint8_t y = 0; y < source.height; y++) {
+      for (uint8_t x = 0; x < source.width; x++) {
+        if (!(bit++ & 7)) {
+          bits = *bitmap++;
+        }
+        if (bits & 0x80) {
+          glyph.rows[y] |= 1 << x;
+        }
+        bits <<= 1;
+      }
+    }
+  }
+}
+
+bool GlyphAtlas::covers(const char* text) const
+{
+  if (!_complete) {
+    return false;
+  }
+
+  for (const char* c = text; *c; c++) {
+    if ((uint8_t)*c < _first || (uint8_t)*c > _last) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Mirrors GFX's charBounds() with wrapping off
+void GlyphAtlas::measure(const char* text, uint8_t size, int16_t layerWidth, int16_t layerHeight,
+    int16_t& x1, int16_t& y1, uint16_t& w, uint16_t& h) const
+{
+  int16_t minX = layerWidth, minY = layerHeight, maxX = -1, maxY = -1;
+  int16_t x = 0;
+
+  for (const char* c = text; *c; c++) {
+    const Glyph& glyph = _glyphs[(uint8_t)*c - FIRST_CHAR];
+    int16_t left, top, right, bottom;
+
+    if (_font == nullptr) {
+      left = x;
+      top = 0;
+      right = x + size * 6 - 1;
+      bottom = size * 8 - 1;
+    } else {
+      left = x + glyph.xOffset * size;
+      top = glyph.yOffset * size;
+      right = left + glyph.width * size - 1;
+      bottom = top + glyph.height * size - 1;
+    }
+
+    minX = min(minX, left);
+    minY = min(minY, top);
+    maxX = max(maxX, right);
+    maxY = max(maxY, bottom);
+    x += glyph.xAdvance * size;
+  }
+
+  x1 = 0;
+  y1 = 0;
+  w = 0;
+  h = 0;
+  if (maxX >= minX) {
+    x1 = minX;
+    w = maxX - minX + 1;
+  }
+  if (maxY >= minY) {
+    y1 = minY;
+    h = maxY - minY + 1;
+  }
+}
+
+void GlyphAtlas::draw(
+    PixelLayer& layer, const char* text, int16_t x, int16_t y, uint8_t size, uint16_t color) const
+{
+  for (const char* c = text; *c; c++) {
+    const Glyph& glyph = _glyphs[(uint8_t)*c - FIRST_CHAR];
+    const int16_t left = x + glyph.xOffset * size;
+    const int16_t top = y + glyph.yOffset * size;
+
+    for (uint8_t row = 0; row < glyph.height; row++) {
+      uint8_t bits = glyph.rows[row];
+      uint8_t column = 0;
+
+      // One line per run of set pixels, repeated for every scaled row
+      while (bits) {
+        while (!(bits & 1)) {
+          bits >>= 1;
+          column++;
+        }
+        uint8_t run = 0;
+        while (bits & 1) {
+          bits >>= 1;
+          run++;
+        }
+
+        for (uint8_t dy = 0; dy < size; dy++) {
+          layer.drawFastHLine(left + column * size, top + row * size + dy, run * size, color);
+        }
+        column += run;
+      }
+    }
+
+    x += glyph.xAdvance * size;
+  }
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "PixelLayer.h"
+#include <Arduino.h>
+#include <gfxfont.h>
+
+/**
+ * GlyphAtlas - Pre-rasterized printable ASCII glyphs of one font
+ *
+ * GFX prints text pixel by pixel (or, scaled, rectangle by rectangle) and walks the font data
+ * again for every measurement. The atlas rasterizes each glyph once, on first use, into one
+ * bitmask per row; drawing a string then becomes a few horizontal runs per glyph row, and
+ * measuring it a table walk. Text and boxes are exactly what GFX would produce, so strings the
+ * atlas can't cover (anything outside 0x20..0x7E) simply go through GFX instead.
+ *
+ * Only used from the render task.
+ */
+class GlyphAtlas {
+  public:
+  // font is a GFXfont, or nullptr for GFX's built-in 5x7 font
+  static const GlyphAtlas* get(const GFXfont* font);
+
+  // True if every character of text has a glyph in the atlas
+  bool covers(const char* text) const;
+  // The box GFX's getTextBounds() reports for text printed at 0,0 on a layer of the given size
+  void measure(const char* text, uint8_t size, int16_t layerWidth, int16_t layerHeight,
+      int16_t& x1, int16_t& y1, uint16_t& w, uint16_t& h) const;
+  // Prints text with the cursor at x,y (top left for the built-in font, baseline for GFXfonts),
+  // leaving the background untouched
+  void draw(PixelLayer& layer, const char* text, int16_t x, int16_t y, uint8_t size,
+      uint16_t color) const;
+
+  private:
+  static const uint8_t FIRST_CHAR = 0x20;
+  static const uint8_t LAST_CHAR = 0x7E;
+  static const uint8_t GLYPH_COUNT = LAST_CHAR - FIRST_CHAR + 1;
+  // Rows are one byte, the largest glyph the atlas takes
+  static const uint8_t MAX_GLYPH_SIZE = 8;
+  static const uint8_t MAX_FONTS = 4;
+
+  struct Glyph {
+    uint8_t rows[MAX_GLYPH_SIZE]; // bit n is column n
+    int8_t xOffset;
+    int8_t yOffset;
+    uint8_t width;
+    uint8_t height;
+    uint8_t xAdvance;
+  };
+
+  GlyphAtlas(const GFXfont* font);
+  void buildBuiltin();
+  void buildFont(const GFXfont* font);
+
+  const GFXfont* _font;
+  // Characters the font has, within FIRST_CHAR..LAST_CHAR
+  uint8_t _first;
+  uint8_t _last;
+  bool _complete; // false if a glyph was too large, nothing is drawn from the atlas then
+  Glyph _glyphs[GLYPH_COUNT];
+};
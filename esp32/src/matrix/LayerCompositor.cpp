@@ -0,0 +1,170 @@
+#include "LayerCompositor.h"
+#include "BlendKernels.h"
+
+LayerCompositor::LayerCompositor(RowSink& sink, uint16_t maxWidth, uint16_t maxHeight)
+    : _sink(sink)
+    , _maxWidth(maxWidth)
+    , _maxHeight(maxHeight)
+    , _doubleBuffered(false)
+    , _pixelsPushed(0)
+{
+  _rowBuffer = new uint16_t[maxWidth];
+  _prevDamageX0 = new int16_t[maxHeight];
+  _prevDamageX1 = new int16_t[maxHeight];
+}
+
+LayerCompositor::~LayerCompositor()
+{
+  delete[] _rowBuffer;
+  delete[] _prevDamageX0;
+  delete[] _prevDamageX1;
+}
+
+// Blends one layer pixel onto the expanded accumulator
+static inline uint32_t blendPixel(
+    uint32_t below, uint16_t pixel, BlendMode mode, uint8_t alpha, uint16_t transparent)
+{
+  if (pixel == transparent) {
+    return mode == BlendMode::Mask ? 0 : below;
+  }
+
+  switch (mode) {
+  case BlendMode::Add:
+    return BlendKernels::add(below, BlendKernels::expand(pixel), alpha);
+  case BlendMode::Multiply:
+    return BlendKernels::multiply(below, BlendKernels::expand(pixel), alpha);
+  case BlendMode::Mask:
+    return below;
+  default:
+    return BlendKernels::normal(below, BlendKernels::expand(pixel), alpha);
+  }
+}
+
+uint8_t LayerCompositor::collectActive(
+    const LayerProperties* properties, uint8_t count, uint8_t* active)
+{
+  uint8_t activeCount = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    if (properties[i].visible && properties[i].opacity > 0) {
+      active[activeCount++] = i;
+    }
+  }
+  return activeCount;
+}
+
+void LayerCompositor::blendRow(PixelLayer* const* layers, const LayerProperties* properties,
+    const uint8_t* active, uint8_t activeCount, int16_t y, int16_t x0, int16_t x1, uint16_t* out)
+{
+  // Only layers with pixels inside the span (or masks, which black out empty areas) matter
+  const uint16_t* rows[MAX_LAYERS];
+  BlendMode modes[MAX_LAYERS];
+  uint8_t alphas[MAX_LAYERS];
+  uint16_t transparent[MAX_LAYERS];
+  const uint8_t* coverage[MAX_LAYERS]; // nullptr for layers without a coverage plane
+  uint8_t rowCount = 0;
+  int16_t spanX0, spanX1;
+
+  for (uint8_t a = 0; a < activeCount; a++) {
+    const PixelLayer* layer = layers[active[a]];
+    const LayerProperties& props = properties[active[a]];
+
+    if (props.blendMode != BlendMode::Mask
+        && !(layer->getRowContent(y, spanX0, spanX1) && spanX0 <= x1 && spanX1 >= x0)) {
+      continue;
+    }
+
+    rows[rowCount] = layer->getRow(y);
+    modes[rowCount] = props.blendMode;
+    alphas[rowCount] = BlendKernels::opacityToAlpha(props.opacity);
+    transparent[rowCount] = layer->transparencyColor;
+    coverage[rowCount] = layer->getCoverageRow(y);
+    rowCount++;
+  }
+
+  for (int16_t x = x0; x <= x1; x++) {
+    uint32_t pixel = 0;
+    for (uint8_t r = 0; r < rowCount; r++) {
+      // Partly covered pixels (anti-aliased edges) take that share of the layer's opacity
+      const uint8_t alpha
+          = coverage[r] != nullptr ? (alphas[r] * coverage[r][x]) >> 5 : alphas[r];
+      pixel = blendPixel(pixel, rows[r][x], modes[r], alpha, transparent[r]);
+    }
+    out[x - x0] = BlendKernels::pack(pixel);
+  }
+}
+
+void LayerCompositor::compose(
+    PixelLayer* const* layers, const LayerProperties* properties, uint8_t count)
+{
+  _pixelsPushed = 0;
+  count = min<uint8_t>(count, MAX_LAYERS);
+
+  // Layers that can contribute anything this frame. Damage is taken from every layer, as a
+  // layer that was just hidden still has to be removed from the output.
+  uint8_t active[MAX_LAYERS];
+  const uint8_t activeCount = collectActive(properties, count, active);
+  bool damaged = false;
+
+  for (uint8_t i = 0; i < count; i++) {
+    damaged |= layers[i]->isDamaged();
+  }
+
+  if (damaged) {
+    for (uint16_t y = 0; y < _maxHeight; y++) {
+      int16_t x0 = INT16_MAX;
+      int16_t x1 = -1;
+      int16_t spanX0, spanX1;
+
+      for (uint8_t i = 0; i < count; i++) {
+        if (layers[i]->getRowDamage(y, spanX0, spanX1)) {
+          x0 = min(x0, spanX0);
+          x1 = max(x1, spanX1);
+        }
+      }
+
+      // The back buffer last saw the frame before the previous one, so it is also missing
+      // whatever changed in the previous frame
+      const int16_t frameX0 = x0;
+      const int16_t frameX1 = x1;
+      if (_doubleBuffered) {
+        x0 = min(x0, _prevDamageX0[y]);
+        x1 = max(x1, _prevDamageX1[y]);
+        _prevDamageX0[y] = frameX0;
+        _prevDamageX1[y] = frameX1;
+      }
+
+      if (x0 > x1) {
+        continue;
+      }
+
+      blendRow(layers, properties, active, activeCount, y, x0, x1, _rowBuffer);
+
+      const int16_t pushed = x1 - x0 + 1;
+      _sink.writeRow(x0, y, _rowBuffer, pushed);
+      _pixelsPushed += pushed;
+    }
+  }
+
+  for (uint8_t i = 0; i < count; i++) {
+    layers[i]->clearDamage();
+  }
+}
+
+void LayerCompositor::readRow(PixelLayer* const* layers, const LayerProperties* properties,
+    uint8_t count, int16_t y, uint16_t* out) const
+{
+  uint8_t active[MAX_LAYERS];
+  const uint8_t activeCount = collectActive(properties, min<uint8_t>(count, MAX_LAYERS), active);
+  blendRow(layers, properties, active, activeCount, y, 0, _maxWidth - 1, out);
+}
+
+void LayerCompositor::setDoubleBuffered(bool doubleBuffered)
+{
+  _doubleBuffered = doubleBuffered;
+
+  // Neither buffer is known to be in sync yet, so the first two frames are pushed in full
+  for (uint16_t y = 0; y < _maxHeight; y++) {
+    _prevDamageX0[y] = 0;
+    _prevDamageX1[y] = _maxWidth - 1;
+  }
+}
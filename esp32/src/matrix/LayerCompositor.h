@@ -0,0 +1,79 @@
+#pragma once
+
+#include "PixelLayer.h"
+
+// Maximum depth of the layer stack
+#define MAX_LAYERS 8
+
+enum class BlendMode : uint8_t {
+  Normal = 0, // layer pixels cover what is below, mixed by opacity
+  Add = 1, // layer pixels are added to what is below, saturating per channel
+  Multiply = 2, // what is below is darkened by the layer pixels
+  Mask = 3, // what is below only shows where the layer has pixels, black elsewhere
+};
+
+struct LayerProperties {
+  BlendMode blendMode;
+  uint8_t opacity; // 0 = invisible, 255 = opaque
+  bool visible;
+};
+
+/**
+ * RowSink - Output device for composited pixels
+ *
+ * Receives one contiguous run of RGB565 pixels per damaged row instead of one call per pixel.
+ */
+class RowSink {
+  public:
+  virtual ~RowSink() { }
+  virtual void writeRow(int16_t x, int16_t y, const uint16_t* pixels, int16_t count) = 0;
+};
+
+/**
+ * LayerCompositor - Merges a stack of PixelLayers onto the output device
+ *
+ * Layers are blended bottom to top in a single pass per pixel. Only the union of the layers'
+ * damaged spans is recomposed and pushed, and per row only layers with content in that
+ * span take part, so hidden, fully transparent or empty layers cost nothing. A layer's coverage
+ * plane, if it has one, scales its opacity per pixel. Damage is cleared once the frame has been
+ * written.
+ */
+class LayerCompositor {
+  public:
+  LayerCompositor(RowSink& sink, uint16_t maxWidth, uint16_t maxHeight);
+  ~LayerCompositor();
+
+  // With two output buffers each frame also carries the previous frame's damage, because the
+  // buffer being written was last updated two frames ago
+  void setDoubleBuffered(bool doubleBuffered);
+
+  // layers[0] is the bottom of the stack
+  void compose(PixelLayer* const* layers, const LayerProperties* properties, uint8_t count);
+
+  // Composites the full width of row y into out without touching damage or the output, e.g.
+  // to read back what the panel shows
+  void readRow(PixelLayer* const* layers, const LayerProperties* properties, uint8_t count,
+      int16_t y, uint16_t* out) const;
+
+  // Number of pixels written to the output by the last composition
+  uint32_t getPixelsPushed() const { return _pixelsPushed; }
+
+  private:
+  // Fills active with the indices of layers that can contribute anything, returns their number
+  static uint8_t collectActive(const LayerProperties* properties, uint8_t count, uint8_t* active);
+  // Blends columns x0..x1 of row y of the active layers into out
+  static void blendRow(PixelLayer* const* layers, const LayerProperties* properties,
+      const uint8_t* active, uint8_t activeCount, int16_t y, int16_t x0, int16_t x1,
+      uint16_t* out);
+
+  RowSink& _sink;
+  uint16_t _maxWidth;
+  uint16_t _maxHeight;
+  uint16_t* _rowBuffer;
+
+  bool _doubleBuffered;
+  int16_t* _prevDamageX0;
+  int16_t* _prevDamageX1;
+
+  uint32_t _pixelsPushed;
+};
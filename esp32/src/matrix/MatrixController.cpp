@@ -2,15 +2,21 @@
 #include "utils/utils.h"
 #include <Fonts/Picopixel.h>
 
-MatrixController* MatrixController::instance = nullptr;
+static_assert(MATRIX_LAYER_COUNT > LAYER_OVERLAY && MATRIX_LAYER_COUNT <= MAX_LAYERS,
+    "MATRIX_LAYER_COUNT must hold the built-in layers and fit the compositor");
 
 MatrixController::MatrixController()
     : matrix(nullptr)
-    , bgLayer(PANEL_WIDTH * PANEL_CHAIN, PANEL_HEIGHT, layer_draw_callback)
-    , textLayer(PANEL_WIDTH * PANEL_CHAIN, PANEL_HEIGHT, layer_draw_callback)
-    , gfx_compositor(layer_draw_callback)
+    , compositor(*this, DisplayGeometry::DISPLAY_WIDTH, DisplayGeometry::DISPLAY_HEIGHT)
+    , lastCompositionMode(-1)
+    , doubleBuffered(false)
+    , dithering(false)
+    , displayedFrame(0)
 {
-  instance = this;
+  for (uint8_t i = 0; i < MATRIX_LAYER_COUNT; i++) {
+    layers[i] = new PixelLayer(DisplayGeometry::DISPLAY_WIDTH, DisplayGeometry::DISPLAY_HEIGHT);
+    layerProperties[i] = { BlendMode::Normal, 255, true };
+  }
 }
 
 MatrixController::~MatrixController()
@@ -18,9 +24,13 @@ MatrixController::~MatrixController()
   if (matrix) {
     delete matrix;
   }
+
+  for (uint8_t i = 0; i < MATRIX_LAYER_COUNT; i++) {
+    delete layers[i];
+  }
 }
 
-void MatrixController::begin()
+void MatrixController::begin(bool useDoubleBuffer)
 {
   HUB75_I2S_CFG mxconfig(PANEL_WIDTH, PANEL_HEIGHT, PANEL_CHAIN,
       { R1_PIN, G1_PIN, B1_PIN, R2_PIN, G2_PIN, B2_PIN, A_PIN, B_PIN, C_PIN, D_PIN, E_PIN, LAT_PIN,
@@ -28,26 +38,41 @@ void MatrixController::begin()
 
   mxconfig.i2sspeed = HUB75_I2S_CFG::HZ_20M;
   mxconfig.min_refresh_rate = 60;
+  mxconfig.double_buff = useDoubleBuffer;
 
   matrix = new MatrixPanel_I2S_DMA(mxconfig);
   matrix->begin();
 
+  doubleBuffered = useDoubleBuffer;
+  compositor.setDoubleBuffered(doubleBuffered);
+
   // Start with minimum safe brightness (will be set from settings in main.cpp)
-  // Values below 3 result in black screen
-  matrix->setBrightness8(3);
+  setBrightness(MIN_PANEL_BRIGHTNESS);
 
-  bgLayer.clear();
-  textLayer.clear();
+  clear();
 
-  gfx_compositor.Stack(bgLayer, textLayer);
+  // Push the whole frame once so the DMA buffer matches the layers
+  getBackgroundLayer().markAllDamaged();
+  compositor.compose(layers, layerProperties, MATRIX_LAYER_COUNT);
+  present();
 }
 
 void MatrixController::setBrightness(uint8_t brightness)
 {
   if (matrix) {
     Serial.printf("MatrixController::setBrightness called with value: %d\n", brightness);
-    matrix->setBrightness8(brightness);
-    Serial.printf("setBrightness8(%d) completed\n", brightness);
+
+    // Values below MIN_PANEL_BRIGHTNESS result in a black screen, so the panel stays there and
+    // the rest of the way down is done by scaling the color LUT
+    const uint8_t panelBrightness = max<uint8_t>(brightness, MIN_PANEL_BRIGHTNESS);
+    matrix->setBrightness8(panelBrightness);
+    colorLut.build(DISPLAY_GAMMA, (max<uint8_t>(brightness, 1) * 256) / panelBrightness);
+    dithering = brightness <= TEMPORAL_DITHER_MAX_BRIGHTNESS;
+
+    // Everything on the panel was expanded with the old tables
+    getBackgroundLayer().markAllDamaged();
+    Serial.printf("setBrightness8(%d) completed, dithering %s\n", panelBrightness,
+        dithering ? "on" : "off");
   } else {
     Serial.println("ERROR: Matrix is null, cannot set brightness!");
   }
@@ -55,20 +80,45 @@ void MatrixController::setBrightness(uint8_t brightness)
 
 void MatrixController::clear()
 {
-  bgLayer.clear();
-  textLayer.clear();
+  for (uint8_t i = 0; i < MATRIX_LAYER_COUNT; i++) {
+    layers[i]->clear();
+  }
+}
+
+PixelLayer* MatrixController::getLayer(uint8_t id)
+{
+  return id < MATRIX_LAYER_COUNT ? layers[id] : nullptr;
+}
+
+void MatrixController::setLayerProperties(uint8_t id, const LayerProperties& properties)
+{
+  if (id >= MATRIX_LAYER_COUNT) {
+    return;
+  }
+
+  LayerProperties& current = layerProperties[id];
+  if (current.blendMode == properties.blendMode && current.opacity == properties.opacity
+      && current.visible == properties.visible) {
+    return;
+  }
+
+  current = properties;
+  // Everything the layer covers (or used to cover) has to be recomposed
+  layers[id]->markAllDamaged();
 }
 
 void MatrixController::drawPixel(int16_t x, int16_t y, uint16_t color)
 {
-  if (matrix) {
+  if (matrix && x >= 0 && x < getWidth() && y >= 0 && y < getHeight()) {
+    DisplayGeometry::toChain(x, y, x, y);
     matrix->drawPixel(x, y, color);
   }
 }
 
 void MatrixController::drawPixelRGB888(int16_t x, int16_t y, uint8_t r, uint8_t g, uint8_t b)
 {
-  if (matrix) {
+  if (matrix && x >= 0 && x < getWidth() && y >= 0 && y < getHeight()) {
+    DisplayGeometry::toChain(x, y, x, y);
     matrix->drawPixelRGB888(x, y, r, g, b);
   }
 }
@@ -76,13 +126,23 @@ void MatrixController::drawPixelRGB888(int16_t x, int16_t y, uint8_t r, uint8_t
 // Taken from https://github.com/mrcodetastic/GFX_Lite/blob/main/src/GFX_Layer.cpp
 // Seems like there is a bug with setting the proper text color, therefore this is copied and
 // adjusted here
-void MatrixController::drawText(const char* buf, textPosition textPos, const GFXfont* f,
-    uint16_t color, uint8_t size, int xAdjust, int yAdjust, int align)
+// Works out where buf goes on the text layer. The cursor is where printing starts, the bounds
+// are the box the printed glyphs cover. atlas is the glyph atlas that can print buf, or nullptr
+// if it has to go through GFX, whose font state is set up for it then.
+TextBounds MatrixController::layoutText(const char* buf, textPosition textPos, const GFXfont* f,
+    uint8_t size, int xAdjust, int yAdjust, int align, int16_t& cursorX, int16_t& cursorY,
+    const GlyphAtlas*& atlas)
 {
-  if (matrix) {
-    int16_t x1, y1;
-    uint16_t w, h;
+  PixelLayer& textLayer = getTextLayer();
+  int16_t x1, y1;
+  uint16_t w, h;
 
+  atlas = GlyphAtlas::get(f);
+  if (atlas->covers(buf)) {
+    atlas->measure(buf, size, textLayer.getLayerWidth(), textLayer.getLayerHeight(), x1, y1, w,
+        h);
+  } else {
+    atlas = nullptr;
     textLayer.setTextWrap(false);
     textLayer.setTextSize(size);
 
@@ -93,64 +153,221 @@ void MatrixController::drawText(const char* buf, textPosition textPos, const GFX
     }
 
     textLayer.getTextBounds(buf, 0, 0, &x1, &y1, &w, &h);
+  }
+
+  const int16_t width = textLayer.getLayerWidth();
+  const int16_t height = textLayer.getLayerHeight();
+  int16_t wstart = (width - w) / 2 + xAdjust;
 
-    int16_t wstart = (PANEL_WIDTH - w) / 2 + xAdjust;
+  if (align == 0) {
+    wstart = 0 + xAdjust;
+  } else if (align == 2) {
+    wstart = width - w + xAdjust;
+  }
 
-    if (align == 0) {
-      wstart = 0 + xAdjust;
-    } else if (align == 2) {
-      wstart = PANEL_WIDTH - w + xAdjust;
+  if (!f) {
+    cursorX = wstart;
+    if (textPos == TOP) {
+      cursorY = yAdjust; // top
+    } else if (textPos == BOTTOM) {
+      cursorY = height - h + yAdjust;
+    } else { // middle
+      cursorY = (height - h) / 2 + yAdjust;
     }
+  } else {
+    cursorX = wstart;
+    if (textPos == TOP) {
+      cursorY = h + yAdjust; // top
+    } else if (textPos == BOTTOM) {
+      cursorX = wstart + 1;
+      cursorY = (height - 1) + yAdjust;
+    } else { // middle
+      cursorY = ((height / 2) + (h / 2)) + yAdjust;
+    }
+  }
 
-    if (!f) {
-      if (textPos == TOP) {
-        textLayer.setCursor(wstart, yAdjust); // top
-      } else if (textPos == BOTTOM) {
-        textLayer.setCursor(wstart, PANEL_HEIGHT - h + yAdjust);
-      } else { // middle
-        textLayer.setCursor(wstart, (PANEL_HEIGHT - h) / 2 + yAdjust); // top
-      }
+  return { (int16_t)(cursorX + x1), (int16_t)(cursorY + y1), w, h };
+}
+
+TextBounds MatrixController::measureText(const char* buf, textPosition textPos, const GFXfont* f,
+    uint8_t size, int xAdjust, int yAdjust, int align)
+{
+  if (!matrix) {
+    return {};
+  }
+
+  int16_t cursorX, cursorY;
+  const GlyphAtlas* atlas;
+  return layoutText(buf, textPos, f, size, xAdjust, yAdjust, align, cursorX, cursorY, atlas);
+}
+
+bool MatrixController::useSmooth(const SmoothFont* smooth, const char* buf, uint8_t size)
+{
+  return smooth != nullptr && smooth->scale == size && SmoothText::covers(*smooth, buf);
+}
+
+TextBounds MatrixController::drawText(const char* buf, textPosition textPos, const GFXfont* f,
+    uint16_t color, uint8_t size, int xAdjust, int yAdjust, int align, const SmoothFont* smooth)
+{
+  if (!matrix) {
+    return {};
+  }
+
+  PixelLayer& textLayer = getTextLayer();
+  int16_t cursorX, cursorY;
+  const GlyphAtlas* atlas;
+  const TextBounds bounds
+      = layoutText(buf, textPos, f, size, xAdjust, yAdjust, align, cursorX, cursorY, atlas);
+
+  // The smooth glyphs share the atlas' layout, so they go wherever the atlas would print
+  if (atlas != nullptr && useSmooth(smooth, buf, size)) {
+    SmoothText::draw(textLayer, *smooth, buf, cursorX, cursorY, color);
+    return bounds;
+  }
+  if (atlas != nullptr) {
+    atlas->draw(textLayer, buf, cursorX, cursorY, size, color);
+    return bounds;
+  }
+
+  textLayer.setCursor(cursorX, cursorY);
+  textLayer.setTextColor(color);
+  textLayer.println(buf);
+
+  return bounds;
+}
+
+void MatrixController::drawTextAt(PixelLayer& layer, const char* buf, const GFXfont* f,
+    uint16_t color, uint8_t size, int16_t x, int16_t y, const SmoothFont* smooth)
+{
+  const GlyphAtlas* atlas = GlyphAtlas::get(f);
+  int16_t x1, y1;
+  uint16_t w, h;
+
+  if (atlas->covers(buf)) {
+    atlas->measure(buf, size, layer.getLayerWidth(), layer.getLayerHeight(), x1, y1, w, h);
+    if (useSmooth(smooth, buf, size)) {
+      SmoothText::draw(layer, *smooth, buf, x - x1, y - y1, color);
     } else {
-      if (textPos == TOP) {
-        textLayer.setCursor(wstart, h + yAdjust); // top
-      } else if (textPos == BOTTOM) {
-        textLayer.setCursor(wstart + 1, (PANEL_HEIGHT - 1) + yAdjust);
-      } else { // middle
-        textLayer.setCursor(wstart, ((PANEL_HEIGHT / 2) + (h / 2)) + yAdjust);
-      }
+      atlas->draw(layer, buf, x - x1, y - y1, size, color);
     }
+    return;
+  }
 
-    textLayer.setTextColor(color);
-    textLayer.println(buf);
+  layer.setTextWrap(false);
+  layer.setTextSize(size);
+  if (f) {
+    layer.setFont((GFXfont*)f);
+  } else {
+    layer.setFont();
+  }
+
+  layer.getTextBounds(buf, 0, 0, &x1, &y1, &w, &h);
+  layer.setCursor(x - x1, y - y1);
+  layer.setTextColor(color);
+  layer.print(buf);
+}
 
-    // textLayer.drawCentreText(buf, textPos, f, color, yAdjust);
+void MatrixController::writeRow(int16_t x, int16_t y, const uint16_t* pixels, int16_t count)
+{
+  // Dithered pixels differ from their neighbours, so runs can't be collapsed
+  if (dithering) {
+    const uint32_t frame = displayedFrame;
+    for (int16_t i = 0; i < count; i++) {
+      const uint8_t threshold = ColorLut::ditherThreshold(x + i, y, frame);
+      int16_t chainX, chainY;
+      DisplayGeometry::toChain(x + i, y, chainX, chainY);
+      matrix->drawPixelRGB888(chainX, chainY, colorLut.red(pixels[i], threshold),
+          colorLut.green(pixels[i], threshold), colorLut.blue(pixels[i], threshold));
+    }
+    return;
+  }
+
+  int16_t runStart = 0;
+
+  for (int16_t i = 1; i <= count; i++) {
+    if (i < count && pixels[i] == pixels[runStart]) {
+      continue;
+    }
+
+    const uint16_t pixel = pixels[runStart];
+    writeRun(x + runStart, y, i - runStart, colorLut.red(pixel), colorLut.green(pixel),
+        colorLut.blue(pixel));
+
+    runStart = i;
   }
 }
 
-void MatrixController::layer_draw_callback(
-    int16_t x, int16_t y, uint8_t r_data, uint8_t g_data, uint8_t b_data)
+void MatrixController::writeRun(
+    int16_t x, int16_t y, int16_t count, uint8_t r, uint8_t g, uint8_t b)
 {
-  if (instance) {
-    instance->drawPixelRGB888(x, y, r_data, g_data, b_data);
+  const bool flipped = DisplayGeometry::isFlipped(y);
+
+  // A run stays contiguous inside a tile, so it is only split at tile edges
+  while (count > 0) {
+    const int16_t span = DisplayGeometry::tileSpan(x, count);
+    int16_t chainX, chainY;
+
+    // Flipped tiles run right to left, so the piece starts at its last virtual pixel
+    DisplayGeometry::toChain(flipped ? x + span - 1 : x, y, chainX, chainY);
+
+    if (span == 1) {
+      matrix->drawPixelRGB888(chainX, chainY, r, g, b);
+    } else {
+      matrix->drawFastHLine(chainX, chainY, span, r, g, b);
+    }
+
+    x += span;
+    count -= span;
   }
 }
 
 void MatrixController::render(uint8_t compositionMode)
 {
   if (matrix) {
-    switch (compositionMode) {
-    case 0:
-      getCompositor().Stack(getBackgroundLayer(), getTextLayer());
-      break;
-    case 1:
-      getCompositor().Blend(getBackgroundLayer(), getTextLayer());
-      break;
-    case 2:
-      getCompositor().Siloette(getBackgroundLayer(), getTextLayer());
-      break;
-    default:
-      getCompositor().Stack(getBackgroundLayer(), getTextLayer());
-      break;
+    // The composition modes are presets for how the text layer sits on the layers below
+    if (compositionMode != lastCompositionMode) {
+      LayerProperties text = layerProperties[LAYER_TEXT];
+
+      switch (compositionMode) {
+      case 1: // Blend
+        text.blendMode = BlendMode::Normal;
+        text.opacity = 127;
+        break;
+      case 2: // Siloette
+        text.blendMode = BlendMode::Mask;
+        text.opacity = 255;
+        break;
+      default: // Stack
+        text.blendMode = BlendMode::Normal;
+        text.opacity = 255;
+        break;
+      }
+
+      setLayerProperties(LAYER_TEXT, text);
+      lastCompositionMode = compositionMode;
     }
+
+    // Dithering moves the thresholds every frame, so even static content is pushed again
+    if (dithering) {
+      getBackgroundLayer().markAllDamaged();
+    }
+
+    compositor.compose(layers, layerProperties, MATRIX_LAYER_COUNT);
+    present();
+  }
+}
+
+void MatrixController::present()
+{
+  if (compositor.getPixelsPushed() == 0) {
+    return;
   }
+
+  // The flip is latched by the DMA engine and takes effect when the current refresh cycle ends,
+  // so the panel always switches between two complete frames
+  if (doubleBuffered) {
+    matrix->flipDMABuffer();
+  }
+
+  displayedFrame++;
 }
\ No newline at end of file
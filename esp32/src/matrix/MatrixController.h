@@ -1,35 +1,112 @@
 #pragma once
 
 #include "../config/pins.h"
+#include "../config/settings.h"
+#include "ColorLut.h"
+#include "DisplayGeometry.h"
+#include "GlyphAtlas.h"
+#include "LayerCompositor.h"
+#include "PixelLayer.h"
+#include "SmoothText.h"
 #include <ESP32-HUB75-MatrixPanel-I2S-DMA.h>
 #include <GFX_Layer.hpp>
 
-class MatrixController {
+// Layer stack, bottom to top. Layers above LAYER_OVERLAY (up to MATRIX_LAYER_COUNT) are free
+// for scenes built over the WebSocket.
+enum LayerId : uint8_t {
+  LAYER_BACKGROUND = 0,
+  LAYER_EFFECTS = 1,
+  LAYER_TEXT = 2,
+  LAYER_OVERLAY = 3,
+};
+
+// Box a text covers on the text layer, empty when w or h is 0
+struct TextBounds {
+  int16_t x;
+  int16_t y;
+  uint16_t w;
+  uint16_t h;
+};
+
+class MatrixController : public RowSink {
   public:
   MatrixController();
   ~MatrixController();
 
-  void begin();
+  // useDoubleBuffer renders into a back buffer that is flipped in once the frame is complete,
+  // so full-frame changes never show half-updated. Costs a second DMA frame buffer.
+  void begin(bool useDoubleBuffer = false);
+  // MIN_BRIGHTNESS..MAX_BRIGHTNESS. Rebuilds the color LUT, which also dims below the panel's
+  // hardware floor and enables temporal dithering at low levels.
   void setBrightness(uint8_t brightness);
   void clear();
+  // Direct panel writes in virtual display coordinates, bypassing the layers
   void drawPixel(int16_t x, int16_t y, uint16_t color);
   void drawPixelRGB888(int16_t x, int16_t y, uint8_t r, uint8_t g, uint8_t b);
   void render(uint8_t compositionMode);
 
-  void drawText(const char* buf, textPosition textPos, const GFXfont* f, uint16_t color,
-      uint8_t size, int xadjust, int yadjust, int align);
+  // Prints buf into the text layer and returns the box it covers. measureText() returns the
+  // same box without drawing. smooth is the anti-aliased version of f, used when it is at
+  // the table's scale and has all the glyphs.
+  TextBounds drawText(const char* buf, textPosition textPos, const GFXfont* f, uint16_t color,
+      uint8_t size, int xadjust, int yadjust, int align, const SmoothFont* smooth = nullptr);
+  TextBounds measureText(const char* buf, textPosition textPos, const GFXfont* f, uint8_t size,
+      int xadjust, int yadjust, int align);
+  // Prints buf into any layer (e.g. an off-screen strip) with the top left of its box at x,y
+  void drawTextAt(PixelLayer& layer, const char* buf, const GFXfont* f, uint16_t color,
+      uint8_t size, int16_t x, int16_t y, const SmoothFont* smooth = nullptr);
+
+  // Size of the virtual display all layers and handlers work in
+  uint16_t getWidth() const { return DisplayGeometry::DISPLAY_WIDTH; }
+  uint16_t getHeight() const { return DisplayGeometry::DISPLAY_HEIGHT; }
+
+  // Writes a composited run to the panel, collapsing equal colors into line fills. Goes
+  // through the driver's public pixel and line calls, not into its DMA bit planes: the driver
+  // keeps those protected, so a row whose pixels all differ still costs one call per pixel.
+  void writeRow(int16_t x, int16_t y, const uint16_t* pixels, int16_t count) override;
+
+  PixelLayer& getBackgroundLayer() { return *layers[LAYER_BACKGROUND]; }
+  PixelLayer& getTextLayer() { return *layers[LAYER_TEXT]; }
+  LayerCompositor& getCompositor() { return compositor; }
 
-  static void layer_draw_callback(
-      int16_t x, int16_t y, uint8_t r_data, uint8_t g_data, uint8_t b_data);
+  // Returns nullptr for ids outside the stack
+  PixelLayer* getLayer(uint8_t id);
+  uint8_t getLayerCount() const { return MATRIX_LAYER_COUNT; }
+  const LayerProperties& getLayerProperties(uint8_t id) const { return layerProperties[id]; }
+  void setLayerProperties(uint8_t id, const LayerProperties& properties);
 
-  GFX_Layer& getBackgroundLayer() { return bgLayer; }
-  GFX_Layer& getTextLayer() { return textLayer; }
-  GFX_LayerCompositor& getCompositor() { return gfx_compositor; }
+  // Composites row y of the whole stack into out (getWidth() pixels), before the color LUT
+  void readCompositedRow(int16_t y, uint16_t* out) const
+  {
+    compositor.readRow(layers, layerProperties, MATRIX_LAYER_COUNT, y, out);
+  }
+
+  // Pixels pushed to the panel by the last render() call
+  uint32_t getPixelsPushed() const { return compositor.getPixelsPushed(); }
+
+  bool isDoubleBuffered() const { return doubleBuffered; }
+  // Sequence number of the frame currently on the panel (counts flips in double buffered mode)
+  uint32_t getDisplayedFrame() const { return displayedFrame; }
+
+  // The driver behind the layers, nullptr before begin()
+  MatrixPanel_I2S_DMA* getPanel() { return matrix; }
 
   private:
+  void present();
+  static bool useSmooth(const SmoothFont* smooth, const char* buf, uint8_t size);
+  TextBounds layoutText(const char* buf, textPosition textPos, const GFXfont* f, uint8_t size,
+      int xAdjust, int yAdjust, int align, int16_t& cursorX, int16_t& cursorY,
+      const GlyphAtlas*& atlas);
+  // Writes count pixels of one color, split into one line fill per tile
+  void writeRun(int16_t x, int16_t y, int16_t count, uint8_t r, uint8_t g, uint8_t b);
+
   MatrixPanel_I2S_DMA* matrix;
-  GFX_Layer bgLayer;
-  GFX_Layer textLayer;
-  GFX_LayerCompositor gfx_compositor;
-  static MatrixController* instance;
+  PixelLayer* layers[MATRIX_LAYER_COUNT];
+  LayerProperties layerProperties[MATRIX_LAYER_COUNT];
+  LayerCompositor compositor;
+  ColorLut colorLut;
+  int lastCompositionMode;
+  bool doubleBuffered;
+  bool dithering;
+  volatile uint32_t displayedFrame;
 };
\ No newline at end of file
@@ -0,0 +1,315 @@
+#include "PixelLayer.h"
+#include "ColorLut.h"
+
+PixelLayer::PixelLayer(uint16_t width, uint16_t height)
+    : GFX(width, height)
+    , _layerWidth(width)
+    , _layerHeight(height)
+    , _damaged(false)
+{
+  // Starts transparent (0x0000): content spans and the pixel == color shortcut in drawPixel()
+  // rely on the buffer matching them, and readbacks must never see old heap contents
+  _pixels = new uint16_t[width * height]();
+  _damageX0 = new int16_t[height];
+  _damageX1 = new int16_t[height];
+  _contentX0 = new int16_t[height];
+  _contentX1 = new int16_t[height];
+
+  for (uint16_t y = 0; y < height; y++) {
+    _contentX0[y] = width;
+    _contentX1[y] = -1;
+  }
+
+  markAllDamaged();
+}
+
+PixelLayer::~PixelLayer()
+{
+  delete[] _pixels;
+  free(_coverage);
+  delete[] _damageX0;
+  delete[] _damageX1;
+  delete[] _contentX0;
+  delete[] _contentX1;
+}
+
+void PixelLayer::drawPixel(int16_t x, int16_t y, uint16_t color)
+{
+  if (x < 0 || x >= _layerWidth || y < 0 || y >= _layerHeight) {
+    return;
+  }
+
+  const int i = y * _layerWidth + x;
+  uint16_t& pixel = _pixels[i];
+  const bool coverageChanged = _coverage != nullptr && _coverage[i] != FULL_COVERAGE;
+  if (pixel == color && !coverageChanged) {
+    return;
+  }
+
+  pixel = color;
+  if (_coverage != nullptr) {
+    _coverage[i] = FULL_COVERAGE;
+  }
+  extendSpan(_damageX0, _damageX1, y, x, x);
+  _damaged = true;
+  _revision++;
+
+  if (color != transparencyColor) {
+    extendSpan(_contentX0, _contentX1, y, x, x);
+  }
+}
+
+void PixelLayer::drawPixel(int16_t x, int16_t y, CRGB color)
+{
+  drawPixel(x, y, color888To565(color.r, color.g, color.b));
+}
+
+void PixelLayer::fillScreen(uint16_t color)
+{
+  for (int i = 0; i < _layerWidth * _layerHeight; i++) {
+    _pixels[i] = color;
+  }
+  if (_coverage != nullptr) {
+    memset(_coverage, FULL_COVERAGE, _layerWidth * _layerHeight);
+  }
+
+  const bool transparent = color == transparencyColor;
+  for (uint16_t y = 0; y < _layerHeight; y++) {
+    _contentX0[y] = transparent ? _layerWidth : 0;
+    _contentX1[y] = transparent ? -1 : _layerWidth - 1;
+  }
+
+  markAllDamaged();
+}
+
+void PixelLayer::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+  if (y < 0 || y >= _layerHeight) {
+    return;
+  }
+
+  const int16_t x0 = max<int16_t>(x, 0);
+  const int16_t x1 = min<int16_t>(x + w - 1, _layerWidth - 1);
+  if (x0 > x1) {
+    return;
+  }
+
+  uint16_t* row = &_pixels[y * _layerWidth];
+  uint8_t* coverage = _coverage != nullptr ? &_coverage[y * _layerWidth] : nullptr;
+  int16_t changedX0 = _layerWidth, changedX1 = -1;
+
+  for (int16_t px = x0; px <= x1; px++) {
+    if (row[px] != color || (coverage != nullptr && coverage[px] != FULL_COVERAGE)) {
+      row[px] = color;
+      if (coverage != nullptr) {
+        coverage[px] = FULL_COVERAGE;
+      }
+      changedX0 = min(changedX0, px);
+      changedX1 = px;
+    }
+  }
+
+  if (changedX0 <= changedX1) {
+    extendSpan(_damageX0, _damageX1, y, changedX0, changedX1);
+    _damaged = true;
+    _revision++;
+  }
+  if (color != transparencyColor) {
+    extendSpan(_contentX0, _contentX1, y, x0, x1);
+  }
+}
+
+void PixelLayer::clear()
+{
+  for (uint16_t y = 0; y < _layerHeight; y++) {
+    if (_contentX0[y] > _contentX1[y]) {
+      continue;
+    }
+
+    uint16_t* row = &_pixels[y * _layerWidth];
+    for (int16_t x = _contentX0[y]; x <= _contentX1[y]; x++) {
+      row[x] = transparencyColor;
+    }
+    if (_coverage != nullptr) {
+      memset(&_coverage[y * _layerWidth + _contentX0[y]], FULL_COVERAGE,
+          _contentX1[y] - _contentX0[y] + 1);
+    }
+
+    extendSpan(_damageX0, _damageX1, y, _contentX0[y], _contentX1[y]);
+    _damaged = true;
+    _revision++;
+
+    _contentX0[y] = _layerWidth;
+    _contentX1[y] = -1;
+  }
+}
+
+void PixelLayer::writePixels(
+    int16_t x, int16_t y, const uint8_t* data, int16_t count, const uint8_t* coverage)
+{
+  if (y < 0 || y >= _layerHeight) {
+    return;
+  }
+
+  if (x < 0) {
+    if (-x >= count) {
+      return;
+    }
+    data += -x * 2;
+    if (coverage != nullptr) {
+      coverage += -x;
+    }
+    count += x;
+    x = 0;
+  }
+  count = min<int16_t>(count, _layerWidth - x);
+
+  uint16_t* row = &_pixels[y * _layerWidth];
+  uint8_t* rowCoverage = _coverage != nullptr ? &_coverage[y * _layerWidth] : nullptr;
+  int16_t changedX0 = _layerWidth, changedX1 = -1;
+  int16_t contentX0 = _layerWidth, contentX1 = -1;
+
+  // Without a plane of its own the layer can't keep partial coverage, those pixels turn opaque
+  if (rowCoverage == nullptr) {
+    coverage = nullptr;
+  }
+
+  for (int16_t px = x; px < x + count; px++, data += 2) {
+    const uint16_t color = data[0] | (data[1] << 8);
+    const uint8_t alpha = coverage != nullptr ? *coverage++ : FULL_COVERAGE;
+
+    if (color != transparencyColor) {
+      contentX0 = min(contentX0, px);
+      contentX1 = px;
+    }
+
+    if (row[px] != color || (rowCoverage != nullptr && rowCoverage[px] != alpha)) {
+      row[px] = color;
+      if (rowCoverage != nullptr) {
+        rowCoverage[px] = alpha;
+      }
+      changedX0 = min(changedX0, px);
+      changedX1 = px;
+    }
+  }
+
+  if (changedX0 <= changedX1) {
+    extendSpan(_damageX0, _damageX1, y, changedX0, changedX1);
+    _damaged = true;
+    _revision++;
+  }
+  if (contentX0 <= contentX1) {
+    extendSpan(_contentX0, _contentX1, y, contentX0, contentX1);
+  }
+}
+
+bool PixelLayer::enableCoverage()
+{
+  if (_coverage != nullptr) {
+    return true;
+  }
+
+  _coverage = (uint8_t*)malloc(_layerWidth * _layerHeight);
+  if (_coverage == nullptr) {
+    Serial.printf("ERROR: Cannot allocate a %ux%u coverage plane\n", _layerWidth, _layerHeight);
+    return false;
+  }
+  memset(_coverage, FULL_COVERAGE, _layerWidth * _layerHeight);
+  return true;
+}
+
+void PixelLayer::drawPixelCoverage(int16_t x, int16_t y, uint16_t color, uint8_t alpha)
+{
+  if (_coverage == nullptr || x < 0 || x >= _layerWidth || y < 0 || y >= _layerHeight) {
+    return;
+  }
+
+  const int i = y * _layerWidth + x;
+  alpha = min<uint8_t>(alpha, FULL_COVERAGE);
+  if (_pixels[i] == color && _coverage[i] == alpha) {
+    return;
+  }
+
+  _pixels[i] = color;
+  _coverage[i] = alpha;
+  extendSpan(_damageX0, _damageX1, y, x, x);
+  _damaged = true;
+  _revision++;
+
+  if (color != transparencyColor) {
+    extendSpan(_contentX0, _contentX1, y, x, x);
+  }
+}
+
+void PixelLayer::markDamaged(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+  x0 = max<int16_t>(x0, 0);
+  y0 = max<int16_t>(y0, 0);
+  x1 = min<int16_t>(x1, _layerWidth - 1);
+  y1 = min<int16_t>(y1, _layerHeight - 1);
+
+  if (x0 > x1 || y0 > y1) {
+    return;
+  }
+
+  for (int16_t y = y0; y <= y1; y++) {
+    extendSpan(_damageX0, _damageX1, y, x0, x1);
+  }
+  _damaged = true;
+  _revision++;
+}
+
+void PixelLayer::markAllDamaged()
+{
+  for (uint16_t y = 0; y < _layerHeight; y++) {
+    _damageX0[y] = 0;
+    _damageX1[y] = _layerWidth - 1;
+  }
+  _damaged = true;
+  _revision++;
+}
+
+bool PixelLayer::getRowDamage(int16_t y, int16_t& x0, int16_t& x1) const
+{
+  if (!_damaged || _damageX0[y] > _damageX1[y]) {
+    return false;
+  }
+
+  x0 = _damageX0[y];
+  x1 = _damageX1[y];
+  return true;
+}
+
+bool PixelLayer::getRowContent(int16_t y, int16_t& x0, int16_t& x1) const
+{
+  if (_contentX0[y] > _contentX1[y]) {
+    return false;
+  }
+
+  x0 = _contentX0[y];
+  x1 = _contentX1[y];
+  return true;
+}
+
+void PixelLayer::clearDamage()
+{
+  if (!_damaged) {
+    return;
+  }
+
+  for (uint16_t y = 0; y < _layerHeight; y++) {
+    _damageX0[y] = _layerWidth;
+    _damageX1[y] = -1;
+  }
+  _damaged = false;
+}
+
+void PixelLayer::extendSpan(int16_t* x0, int16_t* x1, int16_t y, int16_t from, int16_t to)
+{
+  if (from < x0[y]) {
+    x0[y] = from;
+  }
+  if (to > x1[y]) {
+    x1[y] = to;
+  }
+}
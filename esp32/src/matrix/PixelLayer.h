@@ -0,0 +1,91 @@
+#pragma once
+
+#include <GFX_Layer.hpp>
+
+/**
+ * PixelLayer - Off-screen RGB565 pixel buffer with damage tracking
+ *
+ * Drop-in replacement for GFX_Layer. Pixels are kept in the 565 format every draw call already
+ * uses (2 bytes instead of 3 per pixel) and are only widened at the DMA boundary. Every write
+ * records the touched span per row so the compositor only has to recompose and push pixels
+ * that actually changed since the last frame.
+ *
+ * A layer can also carry a coverage plane (enableCoverage()): a 0..32 alpha per pixel that the
+ * compositor multiplies into the layer's opacity, so anti-aliased edges blend with the layers
+ * below instead of with the transparent key. Every regular write makes its pixels fully covered
+ * again, only drawPixelCoverage() and writePixels() with coverage set anything else.
+ */
+class PixelLayer : public GFX {
+  public:
+  PixelLayer(uint16_t width, uint16_t height);
+  ~PixelLayer();
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void drawPixel(int16_t x, int16_t y, CRGB color);
+  void fillScreen(uint16_t color) override;
+  // Clipped run fill with one damage update, also used by GFX's rectangles and lines
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void clear();
+
+  // Copies count little-endian RGB565 pixels (2 bytes each, any alignment) into row y from x on,
+  // clipped to the layer. Damage and content are tracked once per call instead of per pixel.
+  // coverage, if given, holds the pixels' coverage (see below), otherwise they are opaque.
+  void writePixels(
+      int16_t x, int16_t y, const uint8_t* data, int16_t count, const uint8_t* coverage = nullptr);
+
+  // Allocates the coverage plane on first use, false if there is no memory for it
+  bool enableCoverage();
+  bool hasCoverage() const { return _coverage != nullptr; }
+  // A pixel that covers alpha/32 of what is below (0..FULL_COVERAGE), needs enableCoverage()
+  void drawPixelCoverage(int16_t x, int16_t y, uint16_t color, uint8_t alpha);
+  inline uint8_t getCoverage(int16_t x, int16_t y) const
+  {
+    return _coverage != nullptr ? _coverage[y * _layerWidth + x] : FULL_COVERAGE;
+  }
+  // nullptr while the layer has no coverage plane (all pixels fully covered)
+  inline const uint8_t* getCoverageRow(int16_t y) const
+  {
+    return _coverage != nullptr ? &_coverage[y * _layerWidth] : nullptr;
+  }
+
+  static constexpr uint8_t FULL_COVERAGE = 32;
+
+  inline uint16_t getPixel(int16_t x, int16_t y) const { return _pixels[y * _layerWidth + x]; }
+  inline const uint16_t* getRow(int16_t y) const { return &_pixels[y * _layerWidth]; }
+
+  uint16_t getLayerWidth() const { return _layerWidth; }
+  uint16_t getLayerHeight() const { return _layerHeight; }
+
+  // Damage tracking - spans are inclusive, a row is clean when x0 > x1
+  void markDamaged(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+  void markAllDamaged();
+  bool isDamaged() const { return _damaged; }
+  // Changes with every write that touches a pixel (unlike the damage, never reset), so whoever
+  // draws into the layer can tell whether someone else drew since
+  uint32_t getRevision() const { return _revision; }
+  bool getRowDamage(int16_t y, int16_t& x0, int16_t& x1) const;
+  void clearDamage();
+
+  // Columns that may hold non-transparent pixels in row y
+  bool getRowContent(int16_t y, int16_t& x0, int16_t& x1) const;
+
+  uint16_t transparencyColor = 0x0000;
+
+  private:
+  void extendSpan(int16_t* x0, int16_t* x1, int16_t y, int16_t from, int16_t to);
+
+  uint16_t _layerWidth;
+  uint16_t _layerHeight;
+  uint16_t* _pixels;
+  uint8_t* _coverage = nullptr;
+
+  // Columns touched since the last clearDamage()
+  int16_t* _damageX0;
+  int16_t* _damageX1;
+  bool _damaged;
+  uint32_t _revision = 0;
+
+  // Columns holding non-transparent pixels, so clear() only damages what was drawn
+  int16_t* _contentX0;
+  int16_t* _contentX1;
+};
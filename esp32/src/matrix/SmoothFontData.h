@@ -0,0 +1,834 @@
+// Generated by tools/smooth_fonts.py from browser/src/assets/fonts, do not edit
+#pragma once
+
+#include "SmoothText.h"
+
+namespace SmoothFontData {
+
+constexpr uint8_t regularAlpha[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xAA,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00,
+  0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xAA, 0x00, 0xAA, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xAA, 0x00, 0xAA, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x04, 0xFF, 0x00, 0xFF, 0x40, 0x3C,
+  0xFF, 0x55, 0xFF, 0xC3, 0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0xAF, 0xFF, 0xFF, 0xFF, 0xFA, 0x05, 0xFF,
+  0x55, 0xFF, 0x50, 0x05, 0xFF, 0x55, 0xFF, 0x50, 0xAF, 0xFF, 0xFF, 0xFF, 0xFA, 0xBF, 0xFF, 0xFF,
+  0xFF, 0xFB, 0x3C, 0xFF, 0x55, 0xFF, 0xC3, 0x04, 0xFF, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xBB, 0x30, 0x00, 0x00, 0x3C, 0xFF, 0xC4, 0x00, 0x03, 0xCF, 0xFF, 0xFF, 0xFA, 0x3C,
+  0xFF, 0xFF, 0xFF, 0xFA, 0xBF, 0x55, 0xFF, 0x50, 0x00, 0xBF, 0x55, 0xFF, 0x50, 0x00, 0x3C, 0xFF,
+  0xFF, 0xFB, 0x30, 0x03, 0xBF, 0xFF, 0xFF, 0xC3, 0x00, 0x05, 0xFF, 0x55, 0xFB, 0x00, 0x05, 0xFF,
+  0x55, 0xFB, 0xAF, 0xFF, 0xFF, 0xFF, 0xC3, 0xAF, 0xFF, 0xFF, 0xFC, 0x30, 0x00, 0x4C, 0xFF, 0xC3,
+  0x00, 0x00, 0x03, 0xBB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3B, 0xB3, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0x00, 0x03, 0xBA, 0x3B,
+  0xB3, 0x00, 0x3C, 0xFB, 0x00, 0x00, 0x03, 0xCF, 0xC3, 0x00, 0x00, 0x3C, 0xFC, 0x30, 0x00, 0x03,
+  0xCF, 0xC3, 0x00, 0x00, 0x3C, 0xFC, 0x30, 0x00, 0x03, 0xCF, 0xC3, 0x00, 0x00, 0x3C, 0xFC, 0x30,
+  0x00, 0x00, 0xBF, 0xC3, 0x00, 0x3B, 0xB3, 0xAB, 0x30, 0x00, 0xBF, 0xFB, 0x00, 0x00, 0x00, 0xBF,
+  0xFB, 0x00, 0x00, 0x00, 0x3B, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xBB, 0x30, 0x00, 0x00, 0x3C, 0xFF, 0xC3, 0x00, 0x00, 0xBF, 0x55, 0xFB, 0x00, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xA9, 0x66, 0x9A, 0x00, 0x00, 0x06, 0x99,
+  0x60, 0x00, 0x00, 0x06, 0x99, 0x60, 0x00, 0x00, 0xA9, 0x66, 0x9A, 0x00, 0xAA, 0xFF, 0x00, 0xA9,
+  0x66, 0x9A, 0xFF, 0x40, 0x06, 0x99, 0x60, 0xBF, 0xC4, 0x06, 0x99, 0x60, 0x3C, 0xFF, 0xF9, 0x66,
+  0x9A, 0x03, 0xBF, 0xFA, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3B, 0xB3, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00,
+  0x00, 0xFF, 0xF4, 0x00, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0x00, 0x3C, 0xFC, 0x30, 0x00, 0x00, 0xBF,
+  0xC3, 0x00, 0x00, 0x00, 0xAB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xBA, 0x00, 0x00, 0x00, 0x3C, 0xFB, 0x00, 0x00, 0x03, 0xCF, 0xC3, 0x00, 0x00,
+  0x3C, 0xFC, 0x30, 0x00, 0x00, 0xBF, 0xC3, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xC3,
+  0x00, 0x00, 0x00, 0x3C, 0xFC, 0x30, 0x00, 0x00, 0x03, 0xCF, 0xC3, 0x00, 0x00, 0x00, 0x3C, 0xFB,
+  0x00, 0x00, 0x00, 0x03, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xAB, 0x30, 0x00, 0x00, 0x00, 0xBF, 0xC3, 0x00, 0x00, 0x00, 0x3C, 0xFC, 0x30, 0x00, 0x00,
+  0x03, 0xCF, 0xC3, 0x00, 0x00, 0x00, 0x3C, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x3C,
+  0xFB, 0x00, 0x00, 0x03, 0xCF, 0xC3, 0x00, 0x00, 0x3C, 0xFC, 0x30, 0x00, 0x00, 0xBF, 0xC3, 0x00,
+  0x00, 0x00, 0xAB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAA, 0x00, 0xFF, 0x00, 0xAA, 0xAA,
+  0x04, 0xFF, 0x40, 0xAA, 0x00, 0x3C, 0xFF, 0xC3, 0x00, 0x04, 0xCF, 0xFF, 0xFC, 0x40, 0xAF, 0xFF,
+  0xFF, 0xFF, 0xFA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFA, 0x04, 0xCF, 0xFF, 0xFC, 0x40, 0x00, 0x3C, 0xFF,
+  0xC3, 0x00, 0xAA, 0x04, 0xFF, 0x40, 0xAA, 0xAA, 0x00, 0xFF, 0x00, 0xAA, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x4C, 0xFF, 0xC4, 0x00, 0xAF, 0xFF,
+  0xFF, 0xFF, 0xFA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x4C, 0xFF, 0xC4, 0x00, 0x00, 0x04, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xB3, 0x00, 0x00, 0x00, 0xBF,
+  0xFB, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x04, 0xFF, 0xB0,
+  0x00, 0x00, 0x3C, 0xFC, 0x30, 0x00, 0x00, 0xBF, 0xC3, 0x00, 0x00, 0x00, 0xAB, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF,
+  0xFF, 0xFF, 0xFA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3B, 0xB3, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0x00, 0x00, 0x00, 0xBF, 0xFB,
+  0x00, 0x00, 0x00, 0x3B, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBA, 0x00,
+  0x00, 0x00, 0x3C, 0xFB, 0x00, 0x00, 0x03, 0xCF, 0xC3, 0x00, 0x00, 0x3C, 0xFC, 0x30, 0x00, 0x03,
+  0xCF, 0xC3, 0x00, 0x00, 0x3C, 0xFC, 0x30, 0x00, 0x03, 0xCF, 0xC3, 0x00, 0x00, 0x3C, 0xFC, 0x30,
+  0x00, 0x00, 0xBF, 0xC3, 0x00, 0x00, 0x00, 0xAB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xBF, 0xFF, 0xFB, 0x30, 0x3C, 0xFF, 0xFF, 0xFF, 0xC3, 0xBF, 0xC4, 0x00, 0x05, 0xFB, 0xFF,
+  0x40, 0x00, 0x05, 0xFF, 0xFF, 0x00, 0x03, 0xBF, 0xFF, 0xFF, 0x00, 0x3C, 0xFF, 0xFF, 0xFF, 0x00,
+  0xBF, 0x55, 0xFF, 0xFF, 0x55, 0xFB, 0x00, 0xFF, 0xFF, 0xFF, 0xC3, 0x00, 0xFF, 0xFF, 0xFB, 0x30,
+  0x00, 0xFF, 0xFF, 0x50, 0x00, 0x04, 0xFF, 0xBF, 0x50, 0x00, 0x4C, 0xFB, 0x3C, 0xFF, 0xFF, 0xFF,
+  0xC3, 0x03, 0xBF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xBA, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00,
+  0xBF, 0xFF, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x3C, 0xFF, 0xC3, 0x00, 0x00, 0xBF, 0xFF, 0xFB,
+  0x00, 0x00, 0xAF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xBF, 0xFF, 0xFB, 0x30, 0x3C, 0xFF, 0xFF, 0xFF, 0xC3, 0xBF, 0xC4, 0x00, 0x4C, 0xFB, 0xAB,
+  0x30, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x4C, 0xFB, 0x03, 0xBF,
+  0xFF, 0xFF, 0xC3, 0x3C, 0xFF, 0xFF, 0xFB, 0x30, 0xBF, 0xC4, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
+  0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
+  0xFA, 0x3B, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xAF, 0xFF, 0xFF, 0xFF, 0xB3, 0xAF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x00,
+  0x00, 0x00, 0x05, 0xFB, 0x00, 0x00, 0x03, 0xBF, 0xC3, 0x00, 0x00, 0x3C, 0xFF, 0x40, 0x00, 0x00,
+  0xBF, 0xF9, 0x60, 0x00, 0x00, 0xAF, 0x92, 0xE4, 0x00, 0x00, 0x00, 0x6E, 0xFB, 0x00, 0x00, 0x00,
+  0x05, 0xFF, 0xAB, 0x30, 0x00, 0x04, 0xFF, 0xBF, 0xC4, 0x00, 0x4C, 0xFB, 0x3C, 0xFF, 0xFF, 0xFF,
+  0xC3, 0x03, 0xBF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xBA, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x00, 0x00, 0x03, 0xCF, 0xFF, 0x00, 0x00,
+  0x3C, 0xFF, 0xFF, 0x00, 0x03, 0xCF, 0x55, 0xFF, 0x00, 0x3C, 0xFA, 0x00, 0xFF, 0x00, 0xBF, 0x50,
+  0x04, 0xFF, 0x40, 0xFF, 0x50, 0x4C, 0xFF, 0xC3, 0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0x3B, 0xFF, 0xFF,
+  0xFF, 0xFB, 0x00, 0x00, 0x4C, 0xFF, 0xC3, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3B, 0xFF, 0xFF, 0xFF, 0xFA, 0xBF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xFF,
+  0x50, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFB, 0x30, 0x3B, 0xFF, 0xFF, 0xFF, 0xC3, 0x00, 0x00,
+  0x00, 0x4C, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0xAB, 0x30, 0x00, 0x04, 0xFF, 0xBF, 0xC4, 0x00, 0x4C, 0xFB, 0x3C, 0xFF, 0xFF, 0xFF,
+  0xC3, 0x03, 0xBF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xBF, 0xFF, 0xFA, 0x00, 0x3C, 0xFF, 0xFF, 0xFA, 0x03, 0xCF, 0xC4, 0x00, 0x00, 0x3C,
+  0xFB, 0x30, 0x00, 0x00, 0xBF, 0x50, 0x00, 0x00, 0x00, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFB, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xC4, 0x00, 0x4C, 0xFB, 0xFF, 0x40, 0x00,
+  0x04, 0xFF, 0xFF, 0x40, 0x00, 0x04, 0xFF, 0xBF, 0xC4, 0x00, 0x4C, 0xFB, 0x3C, 0xFF, 0xFF, 0xFF,
+  0xC3, 0x03, 0xBF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xAF, 0xFF, 0xFF, 0xFF, 0xB3, 0xAF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0x00,
+  0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x3C, 0xFB, 0x00, 0x00,
+  0x03, 0xCF, 0xC3, 0x00, 0x00, 0x3C, 0xFC, 0x30, 0x00, 0x03, 0xCF, 0xC3, 0x00, 0x00, 0x3C, 0xFC,
+  0x30, 0x00, 0x03, 0xCF, 0xC3, 0x00, 0x00, 0x3C, 0xFC, 0x30, 0x00, 0x00, 0xBF, 0xC3, 0x00, 0x00,
+  0x00, 0xAB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xBF, 0xFF, 0xFB, 0x30, 0x3C, 0xFF, 0xFF, 0xFF, 0xC3, 0xBF, 0xC4, 0x00, 0x4C, 0xFB, 0xFF,
+  0x40, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x04, 0xFF, 0xAF, 0xC4, 0x00, 0x4C, 0xFA, 0x05, 0xFF,
+  0xFF, 0xFF, 0x50, 0x05, 0xFF, 0xFF, 0xFF, 0x50, 0xAF, 0xC4, 0x00, 0x4C, 0xFA, 0xFF, 0x40, 0x00,
+  0x04, 0xFF, 0xFF, 0x40, 0x00, 0x04, 0xFF, 0xBF, 0xC4, 0x00, 0x4C, 0xFB, 0x3C, 0xFF, 0xFF, 0xFF,
+  0xC3, 0x03, 0xBF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xBF, 0xFF, 0xFB, 0x30, 0x3C, 0xFF, 0xFF, 0xFF, 0xC3, 0xBF, 0xC4, 0x00, 0x4C, 0xFB, 0xFF,
+  0x40, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x04, 0xFF, 0xBF, 0xC4, 0x00, 0x4C, 0xFF, 0x3C, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x03, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x00, 0x00,
+  0x05, 0xFB, 0x00, 0x00, 0x03, 0xBF, 0xC3, 0x00, 0x00, 0x4C, 0xFC, 0x30, 0xAF, 0xFF, 0xFF, 0xC3,
+  0x00, 0xAF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xAA,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x3C, 0xFB, 0x00, 0x00, 0x00, 0xBF, 0xC3, 0x00,
+  0x00, 0x00, 0xAB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xBA, 0x00, 0x00, 0x00, 0x3C, 0xFB, 0x00, 0x00, 0x03, 0xCF, 0xC3, 0x00,
+  0x00, 0x3C, 0xFC, 0x30, 0x00, 0x03, 0xCF, 0xC3, 0x00, 0x00, 0x3C, 0xFB, 0x30, 0x00, 0x00, 0xBF,
+  0x50, 0x00, 0x00, 0x00, 0xBF, 0x50, 0x00, 0x00, 0x00, 0x3C, 0xFB, 0x30, 0x00, 0x00, 0x03, 0xCF,
+  0xC3, 0x00, 0x00, 0x00, 0x3C, 0xFC, 0x30, 0x00, 0x00, 0x03, 0xCF, 0xC3, 0x00, 0x00, 0x00, 0x3C,
+  0xFB, 0x00, 0x00, 0x00, 0x03, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAF, 0xFF, 0xFF,
+  0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xAB, 0x30, 0x00, 0x00, 0x00, 0xBF, 0xC3, 0x00, 0x00, 0x00, 0x3C, 0xFC, 0x30, 0x00, 0x00,
+  0x03, 0xCF, 0xC3, 0x00, 0x00, 0x00, 0x3C, 0xFC, 0x30, 0x00, 0x00, 0x03, 0xBF, 0xC3, 0x00, 0x00,
+  0x00, 0x05, 0xFB, 0x00, 0x00, 0x00, 0x05, 0xFB, 0x00, 0x00, 0x03, 0xBF, 0xC3, 0x00, 0x00, 0x3C,
+  0xFC, 0x30, 0x00, 0x03, 0xCF, 0xC3, 0x00, 0x00, 0x3C, 0xFC, 0x30, 0x00, 0x00, 0xBF, 0xC3, 0x00,
+  0x00, 0x00, 0xAB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xBF, 0xFF, 0xFB, 0x30, 0x3C, 0xFF, 0xFF, 0xFF, 0xC3, 0xBF, 0xC4, 0x00, 0x4C, 0xFB, 0xAB,
+  0x30, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x4C, 0xFB, 0x00, 0x00,
+  0x3B, 0xFF, 0xC3, 0x00, 0x00, 0xBF, 0xFC, 0x30, 0x00, 0x00, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0xAB,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00,
+  0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xBF, 0xFF, 0xFB, 0x30, 0x3C, 0xFF, 0xFF, 0xFF, 0xC3, 0xBF, 0xC4, 0x00, 0x4C, 0xFB, 0xFF,
+  0x40, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0xAA, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x55, 0xFF, 0xFF, 0x00,
+  0xFF, 0xFF, 0xFB, 0xFF, 0x00, 0xFF, 0xFF, 0xF4, 0xFF, 0x00, 0xBF, 0xFF, 0xA0, 0xFF, 0x00, 0x3B,
+  0xB4, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xC4, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xFF, 0xFF,
+  0xFA, 0x03, 0xBF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xBB, 0x30, 0x00, 0x00, 0x3C, 0xFF, 0xC3, 0x00, 0x03, 0xCF, 0x55, 0xFC, 0x30, 0x3C,
+  0xFB, 0x00, 0xBF, 0xC3, 0xBF, 0xC3, 0x00, 0x3C, 0xFB, 0xFF, 0x40, 0x00, 0x04, 0xFF, 0xFF, 0x40,
+  0x00, 0x04, 0xFF, 0xFF, 0xC4, 0x00, 0x4C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC4, 0x00, 0x4C, 0xFF, 0xFF, 0x40, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+  0xFF, 0xAA, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3B, 0xFF, 0xFF, 0xFB, 0x30, 0xBF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xC4, 0x00, 0x4C, 0xFB, 0xFF,
+  0x40, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x04, 0xFF, 0xFF, 0xC4, 0x00, 0x4C, 0xFA, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0xFF, 0xC4, 0x00, 0x4C, 0xFA, 0xFF, 0x40, 0x00,
+  0x04, 0xFF, 0xFF, 0x40, 0x00, 0x04, 0xFF, 0xFF, 0xC4, 0x00, 0x4C, 0xFB, 0xBF, 0xFF, 0xFF, 0xFF,
+  0xC3, 0x3B, 0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xBF, 0xFF, 0xFB, 0x30, 0x3C, 0xFF, 0xFF, 0xFF, 0xC3, 0xBF, 0xC4, 0x00, 0x4C, 0xFB, 0xFF,
+  0x40, 0x00, 0x03, 0xBA, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xBA, 0xBF, 0xC4, 0x00, 0x4C, 0xFB, 0x3C, 0xFF, 0xFF, 0xFF,
+  0xC3, 0x03, 0xBF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3B, 0xFF, 0xFF, 0xFB, 0x30, 0xBF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xC4, 0x00, 0x4C, 0xFB, 0xFF,
+  0x40, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0x40, 0x00, 0x04, 0xFF, 0xFF, 0xC4, 0x00, 0x4C, 0xFB, 0xBF, 0xFF, 0xFF, 0xFF,
+  0xC3, 0x3B, 0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3B, 0xFF, 0xFF, 0xFF, 0xFA, 0xBF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFA, 0x00, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
+  0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
+  0xFA, 0x3B, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3B, 0xFF, 0xFF, 0xFF, 0xFA, 0xBF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFA, 0x00, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xBF, 0xFF, 0xFF, 0xB3, 0x3C, 0xFF, 0xFF, 0xFF, 0xFB, 0xBF, 0xC4, 0x00, 0x4C, 0xFF, 0xFF,
+  0x40, 0x00, 0x03, 0xBA, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAF, 0xB3, 0xFF, 0x00, 0x00,
+  0xAF, 0xFB, 0xFF, 0x40, 0x00, 0x05, 0xFF, 0xBF, 0xC4, 0x00, 0x05, 0xFF, 0x3C, 0xFF, 0xFF, 0xFF,
+  0xFB, 0x03, 0xBF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xAA, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x04, 0xFF, 0xFF, 0xC4, 0x00, 0x4C, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC4, 0x00, 0x4C, 0xFF, 0xFF, 0x40, 0x00,
+  0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+  0xFF, 0xAA, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xAF, 0xFF, 0xFA, 0x00, 0x00, 0xBF, 0xFF, 0xFB, 0x00, 0x00, 0x3C, 0xFF, 0xC3, 0x00, 0x00,
+  0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x3C, 0xFF, 0xC3, 0x00, 0x00, 0xBF, 0xFF, 0xFB,
+  0x00, 0x00, 0xAF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xAF, 0xFF, 0xFA, 0x00, 0x00, 0xBF, 0xFF, 0xFB, 0x00, 0x00, 0x3C, 0xFF, 0xC3, 0x00,
+  0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0x00, 0xAB, 0x30, 0x04, 0xFF, 0x00, 0xBF, 0xC4, 0x4C, 0xFB, 0x00, 0x3C, 0xFF, 0xFF, 0xC3,
+  0x00, 0x03, 0xBF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xAA, 0x00, 0x00, 0x03, 0xBA, 0xFF, 0x00, 0x00, 0x3C, 0xFB, 0xFF, 0x00, 0x03, 0xCF, 0xC3, 0xFF,
+  0x00, 0x3C, 0xFC, 0x30, 0xFF, 0x00, 0xBF, 0xC3, 0x00, 0xFF, 0x56, 0x9B, 0x30, 0x00, 0xFF, 0xF9,
+  0x60, 0x00, 0x00, 0xFF, 0xF9, 0x60, 0x00, 0x00, 0xFF, 0x56, 0x9B, 0x30, 0x00, 0xFF, 0x00, 0xBF,
+  0xC3, 0x00, 0xFF, 0x00, 0x3C, 0xFC, 0x30, 0xFF, 0x00, 0x03, 0xCF, 0xC3, 0xFF, 0x00, 0x00, 0x3C,
+  0xFB, 0xAA, 0x00, 0x00, 0x03, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xAA, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
+  0xFA, 0x3B, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xAB, 0x30, 0x00, 0x03, 0xBA, 0xFF, 0xC3, 0x00, 0x3C, 0xFF, 0xFF, 0xFB, 0x00, 0xBF, 0xFF, 0xFF,
+  0xF9, 0x66, 0x9F, 0xFF, 0xFF, 0x56, 0x99, 0x65, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xAA,
+  0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+  0xFF, 0xAA, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xAA, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF,
+  0xC3, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x30, 0x00, 0xFF, 0xFF, 0xFF, 0xC3, 0x00, 0xFF, 0xFF, 0x55,
+  0xFB, 0x00, 0xFF, 0xFF, 0x00, 0xBF, 0x55, 0xFF, 0xFF, 0x00, 0x3C, 0xFF, 0xFF, 0xFF, 0x00, 0x03,
+  0xCF, 0xFF, 0xFF, 0x00, 0x00, 0x3C, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+  0xFF, 0xAA, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xBF, 0xFF, 0xFB, 0x30, 0x3C, 0xFF, 0xFF, 0xFF, 0xC3, 0xBF, 0xC4, 0x00, 0x4C, 0xFB, 0xFF,
+  0x40, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0x40, 0x00, 0x04, 0xFF, 0xBF, 0xC4, 0x00, 0x4C, 0xFB, 0x3C, 0xFF, 0xFF, 0xFF,
+  0xC3, 0x03, 0xBF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3B, 0xFF, 0xFF, 0xFB, 0x30, 0xBF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xC4, 0x00, 0x4C, 0xFB, 0xFF,
+  0x40, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x04, 0xFF, 0xFF, 0xC4, 0x00, 0x4C, 0xFB, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFB, 0x30, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xBF, 0xFF, 0xFB, 0x30, 0x3C, 0xFF, 0xFF, 0xFF, 0xC3, 0xBF, 0xC4, 0x00, 0x4C, 0xFB, 0xFF,
+  0x40, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xAA, 0x00, 0xFF, 0xFF, 0x00, 0xA9,
+  0x66, 0x9A, 0xFF, 0x40, 0x06, 0x99, 0x60, 0xBF, 0xC4, 0x06, 0x99, 0x60, 0x3C, 0xFF, 0xF9, 0x66,
+  0x9A, 0x03, 0xBF, 0xFA, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3B, 0xFF, 0xFF, 0xFB, 0x30, 0xBF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xC4, 0x00, 0x4C, 0xFB, 0xFF,
+  0x40, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x04, 0xFF, 0xFF, 0xC4, 0x00, 0x4C, 0xFB, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFB, 0x30, 0xFF, 0x55, 0xFF, 0x50, 0x00, 0xFF, 0x00, 0xBF,
+  0x50, 0x00, 0xFF, 0x00, 0x3C, 0xFB, 0x30, 0xFF, 0x00, 0x03, 0xCF, 0xC3, 0xFF, 0x00, 0x00, 0x3C,
+  0xFB, 0xAA, 0x00, 0x00, 0x03, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xBF, 0xFF, 0xFB, 0x30, 0x3C, 0xFF, 0xFF, 0xFF, 0xC3, 0xBF, 0xC4, 0x00, 0x4C, 0xFB, 0xFF,
+  0x40, 0x00, 0x03, 0xBA, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xC4, 0x00, 0x00, 0x00, 0x3C, 0xFF,
+  0xFF, 0xFB, 0x30, 0x03, 0xBF, 0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x4C, 0xFB, 0x00, 0x00, 0x00,
+  0x04, 0xFF, 0xAB, 0x30, 0x00, 0x04, 0xFF, 0xBF, 0xC4, 0x00, 0x4C, 0xFB, 0x3C, 0xFF, 0xFF, 0xFF,
+  0xC3, 0x03, 0xBF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3B, 0xFF, 0xFF, 0xFF, 0xB3, 0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x55, 0xFF, 0x55, 0xFF, 0xAA,
+  0x00, 0xFF, 0x00, 0xAA, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xAA, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0x40, 0x00, 0x04, 0xFF, 0xBF, 0xC4, 0x00, 0x4C, 0xFB, 0x3C, 0xFF, 0xFF, 0xFF,
+  0xC3, 0x03, 0xBF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xAA, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x04, 0xFF, 0xBF, 0xC3, 0x00,
+  0x3C, 0xFB, 0x3C, 0xFB, 0x00, 0xBF, 0xC3, 0x03, 0xCF, 0x55, 0xFC, 0x30, 0x00, 0x3C, 0xFF, 0xC3,
+  0x00, 0x00, 0x03, 0xBB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xAA, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+  0xAA, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xBF, 0x56, 0x99, 0x65, 0xFB, 0x3C, 0xF9, 0x66, 0x9F,
+  0xC3, 0x03, 0xBA, 0x00, 0xAB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xAA, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x04, 0xFF, 0xBF,
+  0xC3, 0x00, 0x3C, 0xFB, 0x3C, 0xFB, 0x00, 0xBF, 0xC3, 0x03, 0xB9, 0x66, 0x9B, 0x30, 0x00, 0x06,
+  0x99, 0x60, 0x00, 0x00, 0x06, 0x99, 0x60, 0x00, 0x03, 0xB9, 0x66, 0x9B, 0x30, 0x3C, 0xFB, 0x00,
+  0xBF, 0xC3, 0xBF, 0xC3, 0x00, 0x3C, 0xFB, 0xFF, 0x40, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+  0xFF, 0xAA, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xAA, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x04, 0xFF, 0xBF,
+  0xC3, 0x00, 0x3C, 0xFB, 0x3C, 0xFB, 0x00, 0xBF, 0xC3, 0x03, 0xCF, 0x55, 0xFC, 0x30, 0x00, 0x3C,
+  0xFF, 0xC3, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xAF, 0xFF, 0xFF, 0xFF, 0xB3, 0xAF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x00,
+  0x00, 0x00, 0x05, 0xFB, 0x00, 0x00, 0x03, 0xBF, 0xC3, 0x00, 0x00, 0x4C, 0xFF, 0x40, 0x00, 0x3B,
+  0xFF, 0xFB, 0x00, 0x00, 0xBF, 0xFF, 0xB3, 0x00, 0x04, 0xFF, 0xC4, 0x00, 0x00, 0x3C, 0xFB, 0x30,
+  0x00, 0x00, 0xBF, 0x50, 0x00, 0x00, 0x00, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
+  0xFA, 0x3B, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3B, 0xFF, 0xFF, 0xFA, 0x00, 0xBF, 0xFF, 0xFF, 0xFA, 0x00, 0xFF, 0xC4, 0x00, 0x00, 0x00,
+  0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
+  0xFA, 0x00, 0x3B, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0x30, 0x00, 0x00, 0x00, 0xBF,
+  0xC3, 0x00, 0x00, 0x00, 0x3C, 0xFC, 0x30, 0x00, 0x00, 0x03, 0xCF, 0xC3, 0x00, 0x00, 0x00, 0x3C,
+  0xFC, 0x30, 0x00, 0x00, 0x03, 0xCF, 0xC3, 0x00, 0x00, 0x00, 0x3C, 0xFC, 0x30, 0x00, 0x00, 0x03,
+  0xCF, 0xC3, 0x00, 0x00, 0x00, 0x3C, 0xFB, 0x00, 0x00, 0x00, 0x03, 0xBA, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xAF, 0xFF, 0xFF, 0xB3, 0x00, 0xAF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0x00,
+  0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0x00, 0xAF, 0xFF, 0xFF,
+  0xFB, 0x00, 0xAF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xBB, 0x30, 0x00, 0x00, 0x3C, 0xFF, 0xC3, 0x00, 0x03, 0xCF, 0x55, 0xFC, 0x30, 0x3C,
+  0xFB, 0x00, 0xBF, 0xC3, 0xBF, 0xC3, 0x00, 0x3C, 0xFB, 0xAB, 0x30, 0x00, 0x03, 0xBA, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF,
+  0xFA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3B, 0xB3, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00,
+  0x4F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xCF, 0xC3, 0x00, 0x00, 0x00,
+  0x3C, 0xFB, 0x00, 0x00, 0x00, 0x03, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFB, 0x30, 0x00, 0x00, 0xAF, 0xFF, 0xC3, 0x00, 0x00, 0x00,
+  0x05, 0xFB, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x03, 0xBF, 0xFF, 0xFF, 0x00, 0x3C, 0xFF, 0xFF,
+  0xFF, 0x00, 0xBF, 0x50, 0x05, 0xFF, 0x40, 0xBF, 0x50, 0x05, 0xFF, 0xC3, 0x3C, 0xFF, 0xFF, 0xFF,
+  0xFB, 0x03, 0xBF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xAA, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xAF, 0xFB, 0x30, 0xFF, 0x55, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
+  0xC4, 0x4C, 0xFB, 0xFF, 0xFB, 0x30, 0x04, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0xFF, 0xFF, 0x50, 0x00,
+  0x00, 0xFF, 0xFF, 0xFB, 0x30, 0x04, 0xFF, 0xFF, 0xFF, 0xC4, 0x4C, 0xFB, 0xFF, 0x55, 0xFF, 0xFF,
+  0xC3, 0xAA, 0x00, 0xAF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFF, 0xFB, 0x30, 0x3C, 0xFF, 0xFF, 0xFF, 0xC3, 0xBF, 0xC4,
+  0x00, 0x4C, 0xFB, 0xFF, 0x40, 0x00, 0x03, 0xBA, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xBA, 0xBF, 0xC4, 0x00, 0x4C, 0xFB, 0x3C, 0xFF, 0xFF, 0xFF,
+  0xC3, 0x03, 0xBF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x03, 0xBF, 0xFA, 0x00, 0xFF, 0x3C, 0xFF, 0xFF, 0x55, 0xFF, 0xBF, 0xC4,
+  0x4C, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x00, 0x00,
+  0x05, 0xFF, 0xFF, 0x40, 0x03, 0xBF, 0xFF, 0xBF, 0xC4, 0x4C, 0xFF, 0xFF, 0x3C, 0xFF, 0xFF, 0x55,
+  0xFF, 0x03, 0xBF, 0xFA, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFF, 0xFB, 0x30, 0x3C, 0xFF, 0xFF, 0xFF, 0xC3, 0xBF, 0x50,
+  0x00, 0x05, 0xFB, 0xFF, 0x50, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xB3, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xBF, 0x50, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xFF, 0xFA,
+  0x00, 0x03, 0xBF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xBB, 0x30, 0x00, 0x00, 0x3C, 0xFF, 0xC3, 0x00, 0x00, 0xBF, 0x55, 0xFB, 0x00,
+  0x00, 0xFF, 0x00, 0xAA, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x3C, 0xFF, 0xC3, 0x00, 0x00, 0xBF,
+  0xFF, 0xFB, 0x00, 0x00, 0xBF, 0xFF, 0xFB, 0x00, 0x00, 0x3C, 0xFF, 0xC3, 0x00, 0x00, 0x04, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFF, 0xB4, 0x00, 0x3C, 0xFF, 0xFF, 0xFF, 0xA0, 0xBF, 0xC4,
+  0x4C, 0xFF, 0xF4, 0xFF, 0x40, 0x04, 0xFF, 0xFB, 0xFF, 0x40, 0x06, 0x9F, 0xFF, 0xBF, 0xC4, 0x5E,
+  0x1B, 0xFF, 0x3C, 0xFF, 0xFF, 0x04, 0xFF, 0x03, 0xBF, 0xFA, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x04,
+  0xFF, 0x00, 0x00, 0x00, 0x4C, 0xFB, 0x00, 0xAF, 0xFF, 0xFF, 0xC3, 0x00, 0xAF, 0xFF, 0xFB, 0x30,
+  0xAA, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xAF, 0xFB, 0x30, 0xFF, 0x55, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
+  0xC4, 0x4C, 0xFB, 0xFF, 0xFC, 0x30, 0x04, 0xFF, 0xFF, 0xC3, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00,
+  0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+  0xFF, 0xAA, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xB3, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0x00, 0x00, 0x00, 0x3C,
+  0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x3C, 0xFF, 0xC3, 0x00, 0x00, 0xBF, 0xFF, 0xFB,
+  0x00, 0x00, 0xAF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0x00, 0xAB, 0x30, 0x04, 0xFF, 0x00, 0xBF, 0xC4, 0x4C, 0xFB, 0x00, 0x3C, 0xFF, 0xFF, 0xC3,
+  0x00, 0x03, 0xBF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xAA, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xBA, 0x00, 0xFF, 0x00, 0x3C, 0xFB, 0x00, 0xFF, 0x00,
+  0xBF, 0xC3, 0x00, 0xFF, 0x56, 0x9B, 0x30, 0x00, 0xFF, 0xF9, 0x60, 0x00, 0x00, 0xFF, 0xF9, 0x60,
+  0x00, 0x00, 0xFF, 0x56, 0x9B, 0x30, 0x00, 0xFF, 0x00, 0xBF, 0xC3, 0x00, 0xFF, 0x00, 0x3C, 0xFB,
+  0x00, 0xAA, 0x00, 0x03, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xAF, 0xB3, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x00, 0x00, 0x00,
+  0x04, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x3C, 0xFF, 0xC3, 0x00, 0x00, 0xBF, 0xFF, 0xFB,
+  0x00, 0x00, 0xAF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3B, 0xFA, 0x00, 0xAB, 0x30, 0xBF, 0xF9, 0x66, 0x9F, 0xC3, 0xFF, 0x56,
+  0x99, 0x65, 0xFB, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0xAF, 0xFB, 0x30, 0xFF, 0x55, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
+  0xC4, 0x4C, 0xFB, 0xFF, 0xFC, 0x30, 0x04, 0xFF, 0xFF, 0xC3, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00,
+  0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+  0xFF, 0xAA, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFF, 0xFB, 0x30, 0x3C, 0xFF, 0xFF, 0xFF, 0xC3, 0xBF, 0xC4,
+  0x00, 0x4C, 0xFB, 0xFF, 0x40, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0x40, 0x00, 0x04, 0xFF, 0xBF, 0xC4, 0x00, 0x4C, 0xFB, 0x3C, 0xFF, 0xFF, 0xFF,
+  0xC3, 0x03, 0xBF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0xAF, 0xFB, 0x30, 0xFF, 0x40, 0xFF, 0xFF, 0xC3, 0xFF, 0xB1,
+  0xE5, 0x4C, 0xFB, 0xFF, 0xF9, 0x60, 0x04, 0xFF, 0xFF, 0xF9, 0x60, 0x04, 0xFF, 0xFF, 0xB1, 0xE5,
+  0x4C, 0xFB, 0xFF, 0x40, 0xFF, 0xFF, 0xC3, 0xFF, 0x00, 0xAF, 0xFB, 0x30, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFA, 0x00, 0xAA, 0x3C, 0xFF, 0xFF, 0x04, 0xFF, 0xBF, 0xC4,
+  0x5E, 0x1B, 0xFF, 0xFF, 0x40, 0x06, 0x9F, 0xFF, 0xFF, 0x40, 0x06, 0x9F, 0xFF, 0xBF, 0xC4, 0x5E,
+  0x1B, 0xFF, 0x3C, 0xFF, 0xFF, 0x04, 0xFF, 0x03, 0xBF, 0xFA, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xAA,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0xAF, 0xFB, 0x30, 0xFF, 0x55, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
+  0xC4, 0x4C, 0xFB, 0xFF, 0xFC, 0x30, 0x03, 0xBA, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFF, 0xFF, 0xFA, 0x3C, 0xFF, 0xFF, 0xFF, 0xFA, 0xBF, 0x50,
+  0x00, 0x00, 0x00, 0xBF, 0x50, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xFF, 0xFB, 0x30, 0x03, 0xBF, 0xFF,
+  0xFF, 0xC3, 0x00, 0x00, 0x00, 0x05, 0xFB, 0x00, 0x00, 0x00, 0x05, 0xFB, 0xAF, 0xFF, 0xFF, 0xFF,
+  0xC3, 0xAF, 0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00,
+  0x4C, 0xFF, 0xC4, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x4C,
+  0xFF, 0xC4, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xAA, 0x00, 0x00, 0xBF, 0x55, 0xFB, 0x00, 0x00, 0x3C, 0xFF,
+  0xC3, 0x00, 0x00, 0x03, 0xBB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00,
+  0x3C, 0xFF, 0xFF, 0x40, 0x03, 0xCF, 0xFF, 0xBF, 0xC4, 0x4C, 0xFF, 0xFF, 0x3C, 0xFF, 0xFF, 0x55,
+  0xFF, 0x03, 0xBF, 0xFA, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x04, 0xFF, 0xBF, 0xC3, 0x00,
+  0x3C, 0xFB, 0x3C, 0xFB, 0x00, 0xBF, 0xC3, 0x03, 0xCF, 0x55, 0xFC, 0x30, 0x00, 0x3C, 0xFF, 0xC3,
+  0x00, 0x00, 0x03, 0xBB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xAA, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xBF, 0x56, 0x99, 0x65, 0xFB, 0x3C, 0xF9, 0x66, 0x9F,
+  0xC3, 0x03, 0xBA, 0x00, 0xAB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xAB, 0x30, 0x00, 0x03, 0xBA, 0xBF, 0xC3, 0x00, 0x3C, 0xFB, 0x3C, 0xFB,
+  0x00, 0xBF, 0xC3, 0x03, 0xB9, 0x66, 0x9B, 0x30, 0x00, 0x06, 0x99, 0x60, 0x00, 0x00, 0x06, 0x99,
+  0x60, 0x00, 0x03, 0xB9, 0x66, 0x9B, 0x30, 0x3C, 0xFB, 0x00, 0xBF, 0xC3, 0xBF, 0xC3, 0x00, 0x3C,
+  0xFB, 0xAB, 0x30, 0x00, 0x03, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40,
+  0x00, 0x04, 0xFF, 0xBF, 0xC4, 0x00, 0x4C, 0xFF, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xBF, 0xFF,
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xAB, 0x30, 0x00, 0x04,
+  0xFF, 0xBF, 0xC4, 0x00, 0x4C, 0xFB, 0x3C, 0xFF, 0xFF, 0xFF, 0xC3, 0x03, 0xBF, 0xFF, 0xFB, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00,
+  0x05, 0xFF, 0xC3, 0x00, 0x00, 0x05, 0xFC, 0x30, 0x00, 0x03, 0xBF, 0xC3, 0x00, 0x00, 0x3C, 0xFB,
+  0x30, 0x00, 0x03, 0xCF, 0x50, 0x00, 0x00, 0x3C, 0xFF, 0x50, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
+  0xFA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xBA, 0x00, 0x00, 0x00, 0x3C, 0xFB, 0x00, 0x00, 0x00, 0xBF, 0xC3, 0x00, 0x00,
+  0x00, 0xFF, 0x40, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x3C, 0xFA, 0x00, 0x00, 0x00, 0xBF,
+  0x50, 0x00, 0x00, 0x00, 0xBF, 0x50, 0x00, 0x00, 0x00, 0x3C, 0xFA, 0x00, 0x00, 0x00, 0x04, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xC3, 0x00, 0x00, 0x00, 0x3C, 0xFB,
+  0x00, 0x00, 0x00, 0x03, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xAB, 0x30, 0x00, 0x00, 0x00, 0xBF, 0xC3, 0x00, 0x00, 0x00, 0x3C, 0xFB, 0x00, 0x00, 0x00,
+  0x04, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xAF, 0xC3, 0x00, 0x00, 0x00,
+  0x05, 0xFB, 0x00, 0x00, 0x00, 0x05, 0xFB, 0x00, 0x00, 0x00, 0xAF, 0xC3, 0x00, 0x00, 0x00, 0xFF,
+  0x40, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x3C, 0xFB, 0x00, 0x00, 0x00, 0xBF, 0xC3, 0x00,
+  0x00, 0x00, 0xAB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xBB, 0x30, 0x00, 0x00, 0x3C, 0xFF, 0xC3, 0x00, 0x00, 0xBF, 0x55, 0xFB, 0x00, 0xAA, 0xAA,
+  0x00, 0xBF, 0x55, 0xFB, 0x00, 0x00, 0x3C, 0xFF, 0xC3, 0x00, 0x00, 0x03, 0xBB, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+constexpr SmoothGlyph regularGlyphs[] = {
+  { 0, 10, 16, 12, 0, 0 }, // 0x20 ' '
+  { 80, 10, 16, 12, 0, 0 }, // 0x21 '!'
+  { 160, 10, 16, 12, 0, 0 }, // 0x22 '"'
+  { 240, 10, 16, 12, 0, 0 }, // 0x23 '#'
+  { 320, 10, 16, 12, 0, 0 }, // 0x24 '$'
+  { 400, 10, 16, 12, 0, 0 }, // 0x25 '%'
+  { 480, 10, 16, 12, 0, 0 }, // 0x26 '&'
+  { 560, 10, 16, 12, 0, 0 }, // 0x27 "'"
+  { 640, 10, 16, 12, 0, 0 }, // 0x28 '('
+  { 720, 10, 16, 12, 0, 0 }, // 0x29 ')'
+  { 800, 10, 16, 12, 0, 0 }, // 0x2A '*'
+  { 880, 10, 16, 12, 0, 0 }, // 0x2B '+'
+  { 960, 10, 16, 12, 0, 0 }, // 0x2C ','
+  { 1040, 10, 16, 12, 0, 0 }, // 0x2D '-'
+  { 1120, 10, 16, 12, 0, 0 }, // 0x2E '.'
+  { 1200, 10, 16, 12, 0, 0 }, // 0x2F '/'
+  { 1280, 10, 16, 12, 0, 0 }, // 0x30 '0'
+  { 1360, 10, 16, 12, 0, 0 }, // 0x31 '1'
+  { 1440, 10, 16, 12, 0, 0 }, // 0x32 '2'
+  { 1520, 10, 16, 12, 0, 0 }, // 0x33 '3'
+  { 1600, 10, 16, 12, 0, 0 }, // 0x34 '4'
+  { 1680, 10, 16, 12, 0, 0 }, // 0x35 '5'
+  { 1760, 10, 16, 12, 0, 0 }, // 0x36 '6'
+  { 1840, 10, 16, 12, 0, 0 }, // 0x37 '7'
+  { 1920, 10, 16, 12, 0, 0 }, // 0x38 '8'
+  { 2000, 10, 16, 12, 0, 0 }, // 0x39 '9'
+  { 2080, 10, 16, 12, 0, 0 }, // 0x3A ':'
+  { 2160, 10, 16, 12, 0, 0 }, // 0x3B ';'
+  { 2240, 10, 16, 12, 0, 0 }, // 0x3C '<'
+  { 2320, 10, 16, 12, 0, 0 }, // 0x3D '='
+  { 2400, 10, 16, 12, 0, 0 }, // 0x3E '>'
+  { 2480, 10, 16, 12, 0, 0 }, // 0x3F '?'
+  { 2560, 10, 16, 12, 0, 0 }, // 0x40 '@'
+  { 2640, 10, 16, 12, 0, 0 }, // 0x41 'A'
+  { 2720, 10, 16, 12, 0, 0 }, // 0x42 'B'
+  { 2800, 10, 16, 12, 0, 0 }, // 0x43 'C'
+  { 2880, 10, 16, 12, 0, 0 }, // 0x44 'D'
+  { 2960, 10, 16, 12, 0, 0 }, // 0x45 'E'
+  { 3040, 10, 16, 12, 0, 0 }, // 0x46 'F'
+  { 3120, 10, 16, 12, 0, 0 }, // 0x47 'G'
+  { 3200, 10, 16, 12, 0, 0 }, // 0x48 'H'
+  { 3280, 10, 16, 12, 0, 0 }, // 0x49 'I'
+  { 3360, 10, 16, 12, 0, 0 }, // 0x4A 'J'
+  { 3440, 10, 16, 12, 0, 0 }, // 0x4B 'K'
+  { 3520, 10, 16, 12, 0, 0 }, // 0x4C 'L'
+  { 3600, 10, 16, 12, 0, 0 }, // 0x4D 'M'
+  { 3680, 10, 16, 12, 0, 0 }, // 0x4E 'N'
+  { 3760, 10, 16, 12, 0, 0 }, // 0x4F 'O'
+  { 3840, 10, 16, 12, 0, 0 }, // 0x50 'P'
+  { 3920, 10, 16, 12, 0, 0 }, // 0x51 'Q'
+  { 4000, 10, 16, 12, 0, 0 }, // 0x52 'R'
+  { 4080, 10, 16, 12, 0, 0 }, // 0x53 'S'
+  { 4160, 10, 16, 12, 0, 0 }, // 0x54 'T'
+  { 4240, 10, 16, 12, 0, 0 }, // 0x55 'U'
+  { 4320, 10, 16, 12, 0, 0 }, // 0x56 'V'
+  { 4400, 10, 16, 12, 0, 0 }, // 0x57 'W'
+  { 4480, 10, 16, 12, 0, 0 }, // 0x58 'X'
+  { 4560, 10, 16, 12, 0, 0 }, // 0x59 'Y'
+  { 4640, 10, 16, 12, 0, 0 }, // 0x5A 'Z'
+  { 4720, 10, 16, 12, 0, 0 }, // 0x5B '['
+  { 4800, 10, 16, 12, 0, 0 }, // 0x5C '\\'
+  { 4880, 10, 16, 12, 0, 0 }, // 0x5D ']'
+  { 4960, 10, 16, 12, 0, 0 }, // 0x5E '^'
+  { 5040, 10, 16, 12, 0, 0 }, // 0x5F '_'
+  { 5120, 10, 16, 12, 0, 0 }, // 0x60 '`'
+  { 5200, 10, 16, 12, 0, 0 }, // 0x61 'a'
+  { 5280, 10, 16, 12, 0, 0 }, // 0x62 'b'
+  { 5360, 10, 16, 12, 0, 0 }, // 0x63 'c'
+  { 5440, 10, 16, 12, 0, 0 }, // 0x64 'd'
+  { 5520, 10, 16, 12, 0, 0 }, // 0x65 'e'
+  { 5600, 10, 16, 12, 0, 0 }, // 0x66 'f'
+  { 5680, 10, 16, 12, 0, 0 }, // 0x67 'g'
+  { 5760, 10, 16, 12, 0, 0 }, // 0x68 'h'
+  { 5840, 10, 16, 12, 0, 0 }, // 0x69 'i'
+  { 5920, 10, 16, 12, 0, 0 }, // 0x6A 'j'
+  { 6000, 10, 16, 12, 0, 0 }, // 0x6B 'k'
+  { 6080, 10, 16, 12, 0, 0 }, // 0x6C 'l'
+  { 6160, 10, 16, 12, 0, 0 }, // 0x6D 'm'
+  { 6240, 10, 16, 12, 0, 0 }, // 0x6E 'n'
+  { 6320, 10, 16, 12, 0, 0 }, // 0x6F 'o'
+  { 6400, 10, 16, 12, 0, 0 }, // 0x70 'p'
+  { 6480, 10, 16, 12, 0, 0 }, // 0x71 'q'
+  { 6560, 10, 16, 12, 0, 0 }, // 0x72 'r'
+  { 6640, 10, 16, 12, 0, 0 }, // 0x73 's'
+  { 6720, 10, 16, 12, 0, 0 }, // 0x74 't'
+  { 6800, 10, 16, 12, 0, 0 }, // 0x75 'u'
+  { 6880, 10, 16, 12, 0, 0 }, // 0x76 'v'
+  { 6960, 10, 16, 12, 0, 0 }, // 0x77 'w'
+  { 7040, 10, 16, 12, 0, 0 }, // 0x78 'x'
+  { 7120, 10, 16, 12, 0, 0 }, // 0x79 'y'
+  { 7200, 10, 16, 12, 0, 0 }, // 0x7A 'z'
+  { 7280, 10, 16, 12, 0, 0 }, // 0x7B '{'
+  { 7360, 10, 16, 12, 0, 0 }, // 0x7C '|'
+  { 7440, 10, 16, 12, 0, 0 }, // 0x7D '}'
+  { 7520, 10, 16, 12, 0, 0 }, // 0x7E '~'
+};
+
+constexpr SmoothFont regular = { regularAlpha, regularGlyphs, 0x20, 0x7E, 2 };
+
+constexpr uint8_t picoAlpha[] = {
+  0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0x00, 0xAA, 0xFF, 0x00, 0xFF,
+  0xFF, 0x00, 0xFF, 0xAA, 0x00, 0xAA, 0x03, 0xBA, 0x00, 0xAB, 0x30, 0x3C, 0xFF, 0x55, 0xFF, 0xC3,
+  0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0xAF, 0xFF, 0xFF, 0xFF, 0xFA, 0x05, 0xFF, 0x55, 0xFF, 0x50, 0x05,
+  0xFF, 0x55, 0xFF, 0x50, 0xAF, 0xFF, 0xFF, 0xFF, 0xFA, 0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0x3C, 0xFF,
+  0x55, 0xFF, 0xC3, 0x03, 0xBA, 0x00, 0xAB, 0x30, 0x00, 0xAB, 0x30, 0x00, 0xFF, 0xC3, 0x06, 0x9F,
+  0xFB, 0x4E, 0x1A, 0xFA, 0xBF, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x3B, 0xB3, 0x04, 0xCF, 0xFB,
+  0xAF, 0xFF, 0xFB, 0xBF, 0xFF, 0xF4, 0x3C, 0xFF, 0xB0, 0x03, 0xBB, 0x30, 0xAA, 0x00, 0xAA, 0xAA,
+  0x00, 0xFF, 0x00, 0x04, 0xFF, 0x00, 0x3C, 0xFB, 0x03, 0xCF, 0xC3, 0x3C, 0xFC, 0x30, 0xBF, 0xC3,
+  0x00, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0xAA, 0xAA, 0x00, 0xAA, 0x03, 0xBB, 0x30, 0x00, 0x3C, 0xFF,
+  0xC3, 0x00, 0xBF, 0x55, 0xFC, 0x30, 0xA9, 0x66, 0x9F, 0xC3, 0x06, 0x99, 0x65, 0xFB, 0x06, 0x99,
+  0x66, 0x9A, 0xA9, 0x66, 0x99, 0x60, 0xBF, 0x56, 0x99, 0x60, 0x3C, 0xF9, 0x66, 0x9A, 0x03, 0xBA,
+  0x00, 0xAA, 0xAA, 0xFF, 0xFF, 0xAA, 0x03, 0xBA, 0x3C, 0xFB, 0xBF, 0xC3, 0xFF, 0x40, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x40, 0xBF, 0xC3, 0x3C, 0xFB, 0x03, 0xBA, 0xAB, 0x30, 0xBF, 0xC3, 0x3C, 0xFB,
+  0x04, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x04, 0xFF, 0x3C, 0xFB, 0xBF, 0xC3, 0xAB, 0x30, 0xAA, 0x00,
+  0xAA, 0xA9, 0x66, 0x9A, 0x06, 0x99, 0x60, 0x06, 0x99, 0x60, 0xA9, 0x66, 0x9A, 0xAA, 0x00, 0xAA,
+  0x03, 0xBB, 0x30, 0x3C, 0xFF, 0xC3, 0xBF, 0xFF, 0xFB, 0xBF, 0xFF, 0xFB, 0x3C, 0xFF, 0xC3, 0x03,
+  0xBB, 0x30, 0x03, 0xBA, 0x3C, 0xFB, 0xBF, 0xC3, 0xAB, 0x30, 0xAF, 0xFF, 0xFA, 0xAF, 0xFF, 0xFA,
+  0xAA, 0xAA, 0x00, 0x00, 0xAA, 0x00, 0x00, 0xFF, 0x00, 0x04, 0xFF, 0x00, 0x3C, 0xFB, 0x03, 0xCF,
+  0xC3, 0x3C, 0xFC, 0x30, 0xBF, 0xC3, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0xAA, 0x00, 0x00,
+  0x03, 0xBB, 0x30, 0x3C, 0xFF, 0xC3, 0xBF, 0x55, 0xFB, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xBF, 0x55, 0xFB, 0x3C, 0xFF, 0xC3, 0x03, 0xBB, 0x30, 0x03, 0xBA,
+  0x3C, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0x3C, 0xFF, 0x04, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xAA, 0xAF, 0xFB, 0x30, 0xAF, 0xFF, 0xC3, 0x00, 0x05, 0xFB, 0x00, 0x05, 0xFB, 0x03, 0xBF,
+  0xC3, 0x3C, 0xFB, 0x30, 0xBF, 0x50, 0x00, 0xFF, 0x50, 0x00, 0xBF, 0xFF, 0xFA, 0x3B, 0xFF, 0xFA,
+  0xAF, 0xFB, 0x30, 0xAF, 0xFF, 0xC3, 0x00, 0x05, 0xFB, 0x00, 0x06, 0x9A, 0x00, 0xA9, 0x60, 0x00,
+  0xA9, 0x60, 0x00, 0x06, 0x9A, 0x00, 0x05, 0xFB, 0xAF, 0xFF, 0xC3, 0xAF, 0xFB, 0x30, 0xAA, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xAA, 0xFF, 0x55, 0xFF, 0xBF, 0xFF, 0xFF, 0x3B, 0xFF, 0xFF,
+  0x00, 0x4C, 0xFF, 0x00, 0x04, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAA, 0x3B, 0xFF, 0xFA, 0xBF,
+  0xFF, 0xFA, 0xFF, 0x50, 0x00, 0xFF, 0x50, 0x00, 0xBF, 0xFB, 0x30, 0x3B, 0xFF, 0xC3, 0x00, 0x05,
+  0xFB, 0x00, 0x05, 0xFB, 0xAF, 0xFF, 0xC3, 0xAF, 0xFB, 0x30, 0x03, 0xBA, 0x00, 0x3C, 0xFA, 0x00,
+  0xBF, 0x50, 0x00, 0xFF, 0x50, 0x00, 0xFF, 0xFB, 0x30, 0xFF, 0xFF, 0xC3, 0xFF, 0x55, 0xFB, 0xBF,
+  0x55, 0xFB, 0x3C, 0xFF, 0xC3, 0x03, 0xBB, 0x30, 0xAF, 0xFF, 0xB3, 0xAF, 0xFF, 0xFB, 0x00, 0x05,
+  0xFF, 0x00, 0x05, 0xFB, 0x03, 0xBF, 0xC3, 0x3C, 0xFC, 0x30, 0xBF, 0xC3, 0x00, 0xFF, 0x40, 0x00,
+  0xFF, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x03, 0xBB, 0x30, 0x3C, 0xFF, 0xC3, 0xBF, 0x55, 0xFB, 0xA9,
+  0x66, 0x9A, 0x06, 0x99, 0x60, 0x06, 0x99, 0x60, 0xA9, 0x66, 0x9A, 0xBF, 0x55, 0xFB, 0x3C, 0xFF,
+  0xC3, 0x03, 0xBB, 0x30, 0x03, 0xBB, 0x30, 0x3C, 0xFF, 0xC3, 0xBF, 0x55, 0xFB, 0xBF, 0x55, 0xFF,
+  0x3C, 0xFF, 0xFF, 0x03, 0xBF, 0xFF, 0x00, 0x05, 0xFF, 0x00, 0x05, 0xFB, 0x00, 0xAF, 0xC3, 0x00,
+  0xAB, 0x30, 0xAA, 0xAA, 0x00, 0x00, 0xAA, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xBA, 0x3C, 0xFB, 0xBF, 0xC3, 0xAB, 0x30, 0x03, 0xBA, 0x3C, 0xFA, 0xBF, 0x50, 0xBF, 0x50,
+  0x3C, 0xFA, 0x03, 0xBA, 0xAF, 0xFF, 0xFA, 0xAF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xAF, 0xFF, 0xFA, 0xAF, 0xFF, 0xFA, 0xAB, 0x30, 0xAF, 0xC3, 0x05, 0xFB, 0x05, 0xFB, 0xAF, 0xC3,
+  0xAB, 0x30, 0xAF, 0xFB, 0x30, 0xAF, 0xFF, 0xC3, 0x00, 0x05, 0xFB, 0x00, 0x05, 0xFB, 0x00, 0xAF,
+  0xC3, 0x00, 0xAB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0xAA, 0x00,
+  0x03, 0xBB, 0x30, 0x3C, 0xFF, 0xC3, 0xBF, 0x55, 0xFB, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+  0x00, 0xAA, 0xFF, 0x40, 0x00, 0xBF, 0xC4, 0x00, 0x3C, 0xFF, 0xFA, 0x03, 0xBF, 0xFA, 0x03, 0xBB,
+  0x30, 0x3C, 0xFF, 0xC3, 0xBF, 0x55, 0xFB, 0xFF, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x55, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xAA, 0x00, 0xAA, 0x3B, 0xFB, 0x30, 0xBF,
+  0xFF, 0xC3, 0xFF, 0x55, 0xFB, 0xFF, 0x56, 0x9A, 0xFF, 0xF9, 0x60, 0xFF, 0xF9, 0x60, 0xFF, 0x56,
+  0x9A, 0xFF, 0x55, 0xFB, 0xBF, 0xFF, 0xC3, 0x3B, 0xFB, 0x30, 0x03, 0xBF, 0xFA, 0x3C, 0xFF, 0xFA,
+  0xBF, 0xC4, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xBF,
+  0xC4, 0x00, 0x3C, 0xFF, 0xFA, 0x03, 0xBF, 0xFA, 0x3B, 0xFB, 0x30, 0xBF, 0xFF, 0xC3, 0xFF, 0x55,
+  0xFB, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x55, 0xFB,
+  0xBF, 0xFF, 0xC3, 0x3B, 0xFB, 0x30, 0x3B, 0xFF, 0xFA, 0xBF, 0xFF, 0xFA, 0xFF, 0x50, 0x00, 0xFF,
+  0x50, 0x00, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFA, 0xFF, 0x50, 0x00, 0xFF, 0x50, 0x00, 0xBF, 0xFF,
+  0xFA, 0x3B, 0xFF, 0xFA, 0x3B, 0xFF, 0xFA, 0xBF, 0xFF, 0xFA, 0xFF, 0x50, 0x00, 0xFF, 0x50, 0x00,
+  0xFF, 0xFA, 0x00, 0xFF, 0xFB, 0x00, 0xFF, 0xC3, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0xAA,
+  0x00, 0x00, 0x03, 0xBF, 0xFA, 0x3C, 0xFF, 0xFA, 0xBF, 0xC4, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x00,
+  0xAA, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xBF, 0x55, 0xFB, 0x3C, 0xFF, 0xC3, 0x03, 0xBB, 0x30,
+  0xAA, 0x00, 0xAA, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x55, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xAA, 0x00, 0xAA, 0xAA, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0xAA, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xAA, 0x00, 0xFF, 0xBF, 0x55, 0xFB,
+  0x3C, 0xFF, 0xC3, 0x03, 0xBB, 0x30, 0xAA, 0x00, 0xAA, 0xFF, 0x40, 0xFB, 0xFF, 0xB1, 0xE4, 0xFF,
+  0xF9, 0x60, 0xFF, 0xF9, 0x60, 0xFF, 0xB1, 0xE4, 0xFF, 0x40, 0xFB, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+  0xFF, 0xAA, 0x00, 0xAA, 0xAA, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0xC4, 0x00, 0xBF, 0xFF, 0xFA, 0x3B,
+  0xFF, 0xFA, 0xAB, 0x30, 0x00, 0x03, 0xBA, 0xFF, 0xC3, 0x00, 0x3C, 0xFF, 0xFF, 0xFB, 0x00, 0xBF,
+  0xFF, 0xFF, 0xF9, 0x66, 0x9F, 0xFF, 0xFF, 0x56, 0x99, 0x65, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xAA, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xAA,
+  0x00, 0x00, 0x00, 0xAA, 0xAB, 0x30, 0x00, 0xAA, 0xFF, 0xC3, 0x00, 0xFF, 0xFF, 0xFB, 0x00, 0xFF,
+  0xFF, 0xF9, 0x65, 0xFF, 0xFF, 0x56, 0x9F, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x3C, 0xFF,
+  0xFF, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xAA, 0x00, 0x00, 0xAA, 0x03, 0xBB, 0x30, 0x3C,
+  0xFF, 0xC3, 0xBF, 0x55, 0xFB, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+  0xFF, 0xBF, 0x55, 0xFB, 0x3C, 0xFF, 0xC3, 0x03, 0xBB, 0x30, 0x3B, 0xFB, 0x30, 0xBF, 0xFF, 0xC3,
+  0xFF, 0x55, 0xFB, 0xFF, 0x55, 0xFB, 0xFF, 0xFF, 0xC3, 0xFF, 0xFC, 0x30, 0xFF, 0xC3, 0x00, 0xFF,
+  0x40, 0x00, 0xFF, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x03, 0xBB, 0x30, 0x3C, 0xFF, 0xC3, 0xBF, 0x55,
+  0xFB, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xBF, 0x56, 0x9A,
+  0x3C, 0xF9, 0x60, 0x03, 0xCF, 0x50, 0x00, 0x3C, 0xFA, 0x00, 0x03, 0xBA, 0x3B, 0xFB, 0x30, 0xBF,
+  0xFF, 0xC3, 0xFF, 0x55, 0xFB, 0xFF, 0x56, 0x9A, 0xFF, 0xF9, 0x60, 0xFF, 0xF9, 0x60, 0xFF, 0x56,
+  0x9A, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xAA, 0x00, 0xAA, 0x03, 0xBF, 0xFA, 0x3C, 0xFF, 0xFA,
+  0xBF, 0x50, 0x00, 0xBF, 0x50, 0x00, 0x3C, 0xFB, 0x30, 0x03, 0xBF, 0xC3, 0x00, 0x05, 0xFB, 0x00,
+  0x05, 0xFB, 0xAF, 0xFF, 0xC3, 0xAF, 0xFB, 0x30, 0xAF, 0xFF, 0xFA, 0xBF, 0xFF, 0xFB, 0x3C, 0xFF,
+  0xC3, 0x04, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xBF, 0x55, 0xFB, 0x3C, 0xFF,
+  0xC3, 0x03, 0xBB, 0x30, 0xAA, 0x00, 0xAA, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
+  0xFF, 0x00, 0xFF, 0xBF, 0x55, 0xFB, 0x3C, 0xFF, 0xC3, 0x04, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00,
+  0xAA, 0x00, 0xAA, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xAA, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xBF, 0x56, 0x99, 0x65, 0xFB, 0x3C, 0xF9, 0x66, 0x9F, 0xC3, 0x03,
+  0xBA, 0x00, 0xAB, 0x30, 0xAA, 0x00, 0xAA, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xA9, 0x66, 0x9A,
+  0x06, 0x99, 0x60, 0x06, 0x99, 0x60, 0xA9, 0x66, 0x9A, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xAA,
+  0x00, 0xAA, 0xAA, 0x00, 0xAA, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xBF, 0x55, 0xFB, 0x3C, 0xFF,
+  0xC3, 0x04, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAA, 0x00,
+  0xAF, 0xFF, 0xB3, 0xAF, 0xFF, 0xFB, 0x00, 0x05, 0xFF, 0x00, 0x05, 0xFB, 0x03, 0xBF, 0xC3, 0x3C,
+  0xFB, 0x30, 0xBF, 0x50, 0x00, 0xFF, 0x50, 0x00, 0xBF, 0xFF, 0xFA, 0x3B, 0xFF, 0xFA, 0x3B, 0xFA,
+  0xBF, 0xFB, 0xFF, 0xC3, 0xFF, 0x40, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x40, 0xFF, 0xC3, 0xBF, 0xFB,
+  0x3B, 0xFA, 0xAA, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0xC3, 0x00, 0x3C, 0xFC,
+  0x30, 0x03, 0xCF, 0xC3, 0x00, 0x3C, 0xFB, 0x00, 0x04, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAA,
+  0xAF, 0xB3, 0xBF, 0xFB, 0x3C, 0xFF, 0x04, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x04, 0xFF, 0x3C, 0xFF,
+  0xBF, 0xFB, 0xAF, 0xB3, 0x03, 0xBB, 0x30, 0x3C, 0xFF, 0xC3, 0xBF, 0x55, 0xFB, 0xAA, 0x00, 0xAA,
+  0xAF, 0xFF, 0xFF, 0xFA, 0xAF, 0xFF, 0xFF, 0xFA, 0xAB, 0x30, 0xBF, 0xC3, 0x3C, 0xFB, 0x03, 0xBA,
+  0xAF, 0xFB, 0x30, 0xAF, 0xFF, 0xC3, 0x00, 0x05, 0xFB, 0x00, 0x05, 0xFF, 0x3B, 0xFF, 0xFF, 0xBF,
+  0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0x3B, 0xFF, 0xB3, 0xAA, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x40,
+  0x00, 0xFF, 0xC3, 0x00, 0xFF, 0xFC, 0x30, 0xFF, 0xFF, 0xC3, 0xFF, 0x55, 0xFB, 0xFF, 0x55, 0xFF,
+  0xBF, 0xFF, 0xFB, 0x3B, 0xFF, 0xB3, 0x03, 0xBF, 0xFA, 0x3C, 0xFF, 0xFA, 0xBF, 0x50, 0x00, 0xBF,
+  0x50, 0x00, 0x3C, 0xFF, 0xFA, 0x03, 0xBF, 0xFA, 0x00, 0x00, 0xAA, 0x00, 0x00, 0xFF, 0x00, 0x04,
+  0xFF, 0x00, 0x3C, 0xFF, 0x03, 0xCF, 0xFF, 0x3C, 0xFF, 0xFF, 0xBF, 0x55, 0xFF, 0xFF, 0x55, 0xFF,
+  0xBF, 0xFF, 0xFB, 0x3B, 0xFF, 0xB3, 0x03, 0xBB, 0x30, 0x0B, 0xFF, 0xC3, 0x4F, 0xFF, 0xFB, 0xBF,
+  0xFF, 0xFA, 0xFF, 0x50, 0x00, 0xBF, 0x50, 0x00, 0x3C, 0xFF, 0xFA, 0x03, 0xBF, 0xFA, 0x03, 0xBA,
+  0x3C, 0xFA, 0xBF, 0x50, 0xFF, 0x50, 0xFF, 0xFA, 0xFF, 0xFB, 0xFF, 0xC3, 0xFF, 0x40, 0xFF, 0x00,
+  0xAA, 0x00, 0x03, 0xBF, 0xB3, 0x3C, 0xFF, 0xFB, 0xBF, 0x55, 0xFF, 0xFF, 0x55, 0xFF, 0xBF, 0xFF,
+  0xFF, 0x3B, 0xFF, 0xFF, 0x00, 0x05, 0xFF, 0x00, 0x05, 0xFB, 0xAF, 0xFF, 0xC3, 0xAF, 0xFB, 0x30,
+  0xAA, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0xC3, 0x00, 0xFF, 0xFC, 0x30, 0xFF,
+  0xFF, 0xC3, 0xFF, 0x55, 0xFB, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xAA, 0x00, 0xAA, 0xAA, 0xAA,
+  0x00, 0x00, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xAA, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x04, 0xFF, 0x3C, 0xFB, 0xBF, 0xC3, 0xAB, 0x30,
+  0xAA, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xAA, 0xFF,
+  0x56, 0x9A, 0xFF, 0xF9, 0x60, 0xFF, 0xF9, 0x60, 0xFF, 0x56, 0x9A, 0xAA, 0x00, 0xAA, 0xAA, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x40, 0xBF, 0xC3, 0x3C, 0xFB,
+  0x03, 0xBA, 0x3B, 0xFA, 0x00, 0xAB, 0x30, 0xBF, 0xF9, 0x66, 0x9F, 0xC3, 0xFF, 0x56, 0x99, 0x65,
+  0xFB, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xAA, 0x00, 0xAA, 0x00, 0xAA,
+  0x3B, 0xFB, 0x30, 0xBF, 0xFF, 0xC3, 0xFF, 0x55, 0xFB, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xAA,
+  0x00, 0xAA, 0x03, 0xBB, 0x30, 0x3C, 0xFF, 0xC3, 0xBF, 0x55, 0xFB, 0xBF, 0x55, 0xFB, 0x3C, 0xFF,
+  0xC3, 0x03, 0xBB, 0x30, 0x3B, 0xFB, 0x30, 0xBF, 0xFF, 0xC3, 0xFF, 0x55, 0xFB, 0xFF, 0x55, 0xFB,
+  0xFF, 0xFF, 0xC3, 0xFF, 0xFC, 0x30, 0xFF, 0xC3, 0x00, 0xAB, 0x30, 0x00, 0x03, 0xBF, 0xB3, 0x3C,
+  0xFF, 0xFB, 0xBF, 0x55, 0xFF, 0xBF, 0x55, 0xFF, 0x3C, 0xFF, 0xFF, 0x03, 0xCF, 0xFF, 0x00, 0x3C,
+  0xFF, 0x00, 0x03, 0xBA, 0x3B, 0xFA, 0xBF, 0xFB, 0xFF, 0xC3, 0xFF, 0x40, 0xFF, 0x00, 0xAA, 0x00,
+  0x03, 0xBF, 0xFA, 0x3C, 0xFF, 0xFA, 0xBF, 0x50, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x3B, 0xFA, 0x04,
+  0xCF, 0xFB, 0xAF, 0xFF, 0xB3, 0xAF, 0xB4, 0x00, 0xAB, 0x30, 0xFF, 0xC3, 0xFF, 0xFB, 0xFF, 0xFB,
+  0xFF, 0xC3, 0xFF, 0x40, 0xFF, 0x40, 0xBF, 0xC3, 0x3C, 0xFB, 0x03, 0xBA, 0xAA, 0x00, 0xAA, 0xFF,
+  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xBF, 0x55, 0xFF, 0x3C, 0xFF, 0xFB, 0x03, 0xBF, 0xB3, 0xAA, 0x00,
+  0xAA, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xBF, 0x55, 0xFB, 0x3C, 0xFF, 0xC3, 0x03, 0xBB, 0x30,
+  0xAA, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xAA, 0x00, 0xFF, 0xBF,
+  0x56, 0x99, 0x65, 0xFB, 0x3C, 0xF9, 0x66, 0x9F, 0xC3, 0x03, 0xBA, 0x00, 0xAB, 0x30, 0xAA, 0x00,
+  0xAA, 0xA9, 0x66, 0x9A, 0x06, 0x99, 0x60, 0x06, 0x99, 0x60, 0xA9, 0x66, 0x9A, 0xAA, 0x00, 0xAA,
+  0xAA, 0x00, 0xAA, 0xBF, 0x55, 0xFF, 0x3C, 0xFF, 0xFF, 0x03, 0xBF, 0xFF, 0x00, 0x05, 0xFF, 0x00,
+  0x05, 0xFB, 0xAF, 0xFF, 0xC3, 0xAF, 0xFB, 0x30, 0xAF, 0xFF, 0xB3, 0xAF, 0xFF, 0xFB, 0x00, 0x05,
+  0xFF, 0x00, 0x06, 0x9A, 0x03, 0xB9, 0x60, 0x3C, 0xFF, 0x50, 0xBF, 0xFF, 0xFA, 0xAF, 0xFF, 0xFA,
+  0x00, 0x3B, 0xFA, 0x00, 0xBF, 0xFB, 0x04, 0xFF, 0xC3, 0x3C, 0xFB, 0x30, 0xBF, 0x50, 0x00, 0xBF,
+  0x50, 0x00, 0x3C, 0xFB, 0x30, 0x04, 0xFF, 0xC3, 0x00, 0xBF, 0xFB, 0x00, 0x3B, 0xFA, 0xAA, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAF, 0xB3, 0x00, 0xBF, 0xFB, 0x00,
+  0x3C, 0xFF, 0x40, 0x03, 0xBF, 0xC3, 0x00, 0x05, 0xFB, 0x00, 0x05, 0xFB, 0x03, 0xBF, 0xC3, 0x3C,
+  0xFF, 0x40, 0xBF, 0xFB, 0x00, 0xAF, 0xB3, 0x00, 0x03, 0xBA, 0x00, 0xAA, 0x3C, 0xF9, 0x65, 0xFB,
+  0xBF, 0x56, 0x9F, 0xC3, 0xAA, 0x00, 0xAB, 0x30,
+};
+
+constexpr SmoothGlyph picoGlyphs[] = {
+  { 0, 0, 0, 4, 0, 2 }, // 0x20 ' '
+  { 0, 2, 10, 4, 0, -8 }, // 0x21 '!'
+  { 10, 6, 4, 8, 0, -8 }, // 0x22 '"'
+  { 22, 10, 10, 12, 0, -8 }, // 0x23 '#'
+  { 72, 6, 12, 8, 0, -8 }, // 0x24 '$'
+  { 108, 6, 10, 8, 0, -8 }, // 0x25 '%'
+  { 138, 8, 10, 10, 0, -8 }, // 0x26 '&'
+  { 178, 2, 4, 4, 0, -8 }, // 0x27 "'"
+  { 182, 4, 10, 6, 0, -8 }, // 0x28 '('
+  { 202, 4, 10, 6, 0, -8 }, // 0x29 ')'
+  { 222, 6, 6, 8, 0, -6 }, // 0x2A '*'
+  { 240, 6, 6, 8, 0, -6 }, // 0x2B '+'
+  { 258, 4, 4, 6, 0, 0 }, // 0x2C ','
+  { 266, 6, 2, 8, 0, -4 }, // 0x2D '-'
+  { 272, 2, 2, 4, 0, 0 }, // 0x2E '.'
+  { 274, 6, 10, 8, 0, -8 }, // 0x2F '/'
+  { 304, 6, 10, 8, 0, -8 }, // 0x30 '0'
+  { 334, 4, 10, 6, 0, -8 }, // 0x31 '1'
+  { 354, 6, 10, 8, 0, -8 }, // 0x32 '2'
+  { 384, 6, 10, 8, 0, -8 }, // 0x33 '3'
+  { 414, 6, 10, 8, 0, -8 }, // 0x34 '4'
+  { 444, 6, 10, 8, 0, -8 }, // 0x35 '5'
+  { 474, 6, 10, 8, 0, -8 }, // 0x36 '6'
+  { 504, 6, 10, 8, 0, -8 }, // 0x37 '7'
+  { 534, 6, 10, 8, 0, -8 }, // 0x38 '8'
+  { 564, 6, 10, 8, 0, -8 }, // 0x39 '9'
+  { 594, 2, 6, 4, 0, -6 }, // 0x3A ':'
+  { 600, 4, 8, 6, 0, -6 }, // 0x3B ';'
+  { 616, 4, 6, 6, 0, -6 }, // 0x3C '<'
+  { 628, 6, 6, 8, 0, -6 }, // 0x3D '='
+  { 646, 4, 6, 6, 0, -6 }, // 0x3E '>'
+  { 658, 6, 10, 8, 0, -8 }, // 0x3F '?'
+  { 688, 6, 10, 8, 0, -8 }, // 0x40 '@'
+  { 718, 6, 10, 8, 0, -8 }, // 0x41 'A'
+  { 748, 6, 10, 8, 0, -8 }, // 0x42 'B'
+  { 778, 6, 10, 8, 0, -8 }, // 0x43 'C'
+  { 808, 6, 10, 8, 0, -8 }, // 0x44 'D'
+  { 838, 6, 10, 8, 0, -8 }, // 0x45 'E'
+  { 868, 6, 10, 8, 0, -8 }, // 0x46 'F'
+  { 898, 6, 10, 8, 0, -8 }, // 0x47 'G'
+  { 928, 6, 10, 8, 0, -8 }, // 0x48 'H'
+  { 958, 2, 10, 4, 0, -8 }, // 0x49 'I'
+  { 968, 6, 10, 8, 0, -8 }, // 0x4A 'J'
+  { 998, 6, 10, 8, 0, -8 }, // 0x4B 'K'
+  { 1028, 6, 10, 8, 0, -8 }, // 0x4C 'L'
+  { 1058, 10, 10, 12, 0, -8 }, // 0x4D 'M'
+  { 1108, 8, 10, 10, 0, -8 }, // 0x4E 'N'
+  { 1148, 6, 10, 8, 0, -8 }, // 0x4F 'O'
+  { 1178, 6, 10, 8, 0, -8 }, // 0x50 'P'
+  { 1208, 6, 12, 8, 0, -8 }, // 0x51 'Q'
+  { 1244, 6, 10, 8, 0, -8 }, // 0x52 'R'
+  { 1274, 6, 10, 8, 0, -8 }, // 0x53 'S'
+  { 1304, 6, 10, 8, 0, -8 }, // 0x54 'T'
+  { 1334, 6, 10, 8, 0, -8 }, // 0x55 'U'
+  { 1364, 6, 10, 8, 0, -8 }, // 0x56 'V'
+  { 1394, 10, 10, 12, 0, -8 }, // 0x57 'W'
+  { 1444, 6, 10, 8, 0, -8 }, // 0x58 'X'
+  { 1474, 6, 10, 8, 0, -8 }, // 0x59 'Y'
+  { 1504, 6, 10, 8, 0, -8 }, // 0x5A 'Z'
+  { 1534, 4, 10, 6, 0, -8 }, // 0x5B '['
+  { 1554, 6, 10, 8, 0, -8 }, // 0x5C '\\'
+  { 1584, 4, 10, 6, 0, -8 }, // 0x5D ']'
+  { 1604, 6, 4, 8, 0, -8 }, // 0x5E '^'
+  { 1616, 8, 2, 8, 0, 2 }, // 0x5F '_'
+  { 1624, 4, 4, 6, 0, -8 }, // 0x60 '`'
+  { 1632, 6, 8, 8, 0, -6 }, // 0x61 'a'
+  { 1656, 6, 10, 8, 0, -8 }, // 0x62 'b'
+  { 1686, 6, 6, 8, 0, -4 }, // 0x63 'c'
+  { 1704, 6, 10, 8, 0, -8 }, // 0x64 'd'
+  { 1734, 6, 8, 8, 0, -6 }, // 0x65 'e'
+  { 1758, 4, 10, 6, 0, -8 }, // 0x66 'f'
+  { 1778, 6, 10, 8, 0, -6 }, // 0x67 'g'
+  { 1808, 6, 10, 8, 0, -8 }, // 0x68 'h'
+  { 1838, 2, 10, 4, 0, -8 }, // 0x69 'i'
+  { 1848, 4, 12, 6, 0, -8 }, // 0x6A 'j'
+  { 1872, 6, 10, 8, 0, -8 }, // 0x6B 'k'
+  { 1902, 4, 10, 6, 0, -8 }, // 0x6C 'l'
+  { 1922, 10, 6, 12, 0, -4 }, // 0x6D 'm'
+  { 1952, 6, 6, 8, 0, -4 }, // 0x6E 'n'
+  { 1970, 6, 6, 8, 0, -4 }, // 0x6F 'o'
+  { 1988, 6, 8, 8, 0, -4 }, // 0x70 'p'
+  { 2012, 6, 8, 8, 0, -4 }, // 0x71 'q'
+  { 2036, 4, 6, 6, 0, -4 }, // 0x72 'r'
+  { 2048, 6, 8, 8, 0, -6 }, // 0x73 's'
+  { 2072, 4, 10, 6, 0, -8 }, // 0x74 't'
+  { 2092, 6, 6, 8, 0, -4 }, // 0x75 'u'
+  { 2110, 6, 6, 8, 0, -4 }, // 0x76 'v'
+  { 2128, 10, 6, 12, 0, -4 }, // 0x77 'w'
+  { 2158, 6, 6, 8, 0, -4 }, // 0x78 'x'
+  { 2176, 6, 8, 8, 0, -4 }, // 0x79 'y'
+  { 2200, 6, 8, 8, 0, -6 }, // 0x7A 'z'
+  { 2224, 6, 10, 8, 0, -8 }, // 0x7B '{'
+  { 2254, 2, 12, 4, 0, -8 }, // 0x7C '|'
+  { 2266, 6, 10, 8, 0, -8 }, // 0x7D '}'
+  { 2296, 8, 4, 10, 0, -6 }, // 0x7E '~'
+};
+
+constexpr SmoothFont pico = { picoAlpha, picoGlyphs, 0x20, 0x7E, 2 };
+
+} // namespace SmoothFontData
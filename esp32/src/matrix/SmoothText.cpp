@@ -0,0 +1,87 @@
+#include "SmoothText.h"
+#include "BlendKernels.h"
+#include "SmoothFontData.h"
+
+namespace {
+
+// 4 bit coverage to the kernels' 0..32 alpha
+constexpr uint8_t COVERAGE_TO_ALPHA[16]
+    = { 0, 2, 4, 6, 9, 11, 13, 15, 17, 19, 21, 23, 26, 28, 30, 32 };
+
+} // namespace
+
+namespace SmoothText {
+
+const SmoothFont* find(FontId font, uint8_t size)
+{
+  const SmoothFont& table = font == FONT_REGULAR ? SmoothFontData::regular : SmoothFontData::pico;
+  return size == table.scale ? &table : nullptr;
+}
+
+bool covers(const SmoothFont& font, const char* text)
+{
+  for (const char* c = text; *c; c++) {
+    if ((uint8_t)*c < font.first || (uint8_t)*c > font.last) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void draw(PixelLayer& layer, const SmoothFont& font, const char* text, int16_t x, int16_t y,
+    uint16_t color)
+{
+  const int16_t layerWidth = layer.getLayerWidth();
+  const int16_t layerHeight = layer.getLayerHeight();
+  const uint32_t above = BlendKernels::expand(color);
+  // Edge coverage goes into the layer's coverage plane so the compositor blends it with the
+  // layers below; blending it into the transparent key here would give the text a dark rim
+  const bool withCoverage = layer.enableCoverage();
+
+  for (const char* c = text; *c; c++) {
+    const SmoothGlyph& glyph = font.glyphs[(uint8_t)*c - font.first];
+    const uint8_t* alpha = font.alpha + glyph.offset;
+    const uint8_t rowBytes = (glyph.width + 1) >> 1;
+    const int16_t left = x + glyph.xOffset;
+    const int16_t top = y + glyph.yOffset;
+
+    for (uint8_t row = 0; row < glyph.height; row++, alpha += rowBytes) {
+      const int16_t py = top + row;
+      if (py < 0 || py >= layerHeight) {
+        continue;
+      }
+
+      for (uint8_t column = 0; column < glyph.width; column++) {
+        const int16_t px = left + column;
+        const uint8_t coverage
+            = column & 1 ? alpha[column >> 1] & 0x0F : alpha[column >> 1] >> 4;
+        if (coverage == 0 || px < 0 || px >= layerWidth) {
+          continue;
+        }
+
+        const uint8_t alpha = COVERAGE_TO_ALPHA[coverage];
+        const uint16_t below = layer.getPixel(px, py);
+
+        if (!withCoverage) {
+          // Opaque pixels only, the edges are cut where they are less than half covered
+          if (alpha >= PixelLayer::FULL_COVERAGE / 2) {
+            layer.drawPixel(px, py, color);
+          }
+        } else if (below == layer.transparencyColor) {
+          layer.drawPixelCoverage(px, py, color, alpha);
+        } else {
+          // Over another glyph: both coverages combined, the colors mixed by the new one's share
+          const uint8_t belowAlpha = layer.getCoverage(px, py);
+          const uint8_t combined = belowAlpha + ((alpha * (32 - belowAlpha)) >> 5);
+          const uint32_t mixed = BlendKernels::normal(
+              BlendKernels::expand(below), above, (alpha << 5) / combined);
+          layer.drawPixelCoverage(px, py, BlendKernels::pack(mixed), combined);
+        }
+      }
+    }
+
+    x += glyph.xAdvance;
+  }
+}
+
+} // namespace SmoothText
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "PixelLayer.h"
+#include <Arduino.h>
+
+// One glyph of a SmoothFont, laid out like a GFXglyph at the table's scale
+struct SmoothGlyph {
+  uint16_t offset; // first byte in SmoothFont::alpha
+  uint8_t width;
+  uint8_t height;
+  uint8_t xAdvance;
+  int8_t xOffset;
+  int8_t yOffset;
+};
+
+// Anti-aliased glyphs generated from a 1 bit font (see tools/smooth_fonts.py)
+struct SmoothFont {
+  // 4 bit coverage, two pixels per byte (high nibble first), rows padded to whole bytes
+  const uint8_t* alpha;
+  const SmoothGlyph* glyphs;
+  uint8_t first;
+  uint8_t last;
+  // The text size the glyphs replace, their boxes match the 1 bit font's at that size
+  uint8_t scale;
+};
+
+/**
+ * SmoothText - Anti-aliased text from the generated glyph tables
+ *
+ * 4 bit coverage is mapped to the compositor's 0..32 alpha through a table and written to the
+ * layer's coverage plane, so edges blend with whatever the layers below show. Where glyphs
+ * overlap, the colors are mixed with the SWAR kernels. Layout (boxes and cursor) is left to the
+ * 1 bit font, so switching between the two never moves the text.
+ *
+ * Only used from the render task.
+ */
+namespace SmoothText {
+
+enum FontId : uint8_t {
+  FONT_REGULAR, // GFX's built-in font
+  FONT_PICO,
+};
+
+// The table for font at size, nullptr if there is none
+const SmoothFont* find(FontId font, uint8_t size);
+
+// True if every character of text has a glyph in font
+bool covers(const SmoothFont& font, const char* text);
+
+// Prints text with the cursor at x,y, as GlyphAtlas::draw() does at the font's scale
+void draw(PixelLayer& layer, const SmoothFont& font, const char* text, int16_t x, int16_t y,
+    uint16_t color);
+
+} // namespace SmoothText
@@ -1,4 +1,5 @@
 #include "OTAUpdateHandler.h"
+#include "../websocket/Outbox.h"
 
 #include <Update.h>
 
@@ -21,9 +22,8 @@ static void sendProgress(int progress)
   doc["action"] = "updateProgress";
   doc["progress"] = progress;
 
-  String json;
-  serializeJson(doc, json);
-  g_ws->textAll(json);
+  // Only the latest progress waits for slow clients
+  Outbox::broadcast(Outbox::serialize(doc), false, Outbox::KIND_UPDATE_PROGRESS);
 }
 
 static void handleUpdate(AsyncWebServerRequest* request)
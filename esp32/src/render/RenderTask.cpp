@@ -0,0 +1,91 @@
+#include "RenderTask.h"
+#include "../config/settings.h"
+
+namespace RenderTask {
+
+static TaskHandle_t g_task = nullptr;
+static FrameCallback g_frameCallback = nullptr;
+static volatile uint16_t g_targetFps = 0;
+static Stats g_stats = {};
+
+// Tick at which frame n of the current schedule is due, computed from the schedule start so
+// rounding never accumulates into drift
+static TickType_t frameDeadline(TickType_t start, uint32_t frame, uint16_t fps)
+{
+  return start + (TickType_t)(((uint64_t)frame * configTICK_RATE_HZ) / fps);
+}
+
+static void taskLoop(void* param)
+{
+  uint16_t fps = g_targetFps;
+  TickType_t scheduleStart = xTaskGetTickCount();
+  TickType_t lastWake = scheduleStart;
+  uint32_t frame = 0;
+
+  for (;;) {
+    const uint32_t frameStart = micros();
+
+    g_frameCallback();
+
+    const uint32_t frameMicros = micros() - frameStart;
+    g_stats.frames++;
+    g_stats.lastFrameMicros = frameMicros;
+    if (frameMicros > g_stats.maxFrameMicros) {
+      g_stats.maxFrameMicros = frameMicros;
+    }
+
+    if (fps != g_targetFps) {
+      fps = g_targetFps;
+      scheduleStart = xTaskGetTickCount();
+      lastWake = scheduleStart;
+      frame = 0;
+    }
+
+    frame++;
+    const TickType_t deadline = frameDeadline(scheduleStart, frame, fps);
+    const TickType_t now = xTaskGetTickCount();
+
+    if ((int32_t)(now - deadline) >= 0) {
+      // Missed the slot - restart the schedule instead of rendering a burst of late frames.
+      // Still block for a tick: taskYIELD() would only let tasks of our priority run, and loop()
+      // (WiFi, reset button, outgoing messages) sits below us on this core.
+      g_stats.overruns++;
+      vTaskDelay(1);
+      scheduleStart = xTaskGetTickCount();
+      lastWake = scheduleStart;
+      frame = 0;
+      continue;
+    }
+
+    vTaskDelayUntil(&lastWake, deadline - lastWake);
+  }
+}
+
+void begin(FrameCallback frameCallback, uint16_t targetFps)
+{
+  g_frameCallback = frameCallback;
+  g_targetFps = max<uint16_t>(targetFps, 1);
+  g_stats.targetFps = g_targetFps;
+
+  xTaskCreatePinnedToCore(taskLoop, "render", RENDER_TASK_STACK_SIZE, nullptr,
+      RENDER_TASK_PRIORITY, &g_task, RENDER_TASK_CORE);
+
+  Serial.printf("RenderTask started on core %d at %u fps\n", RENDER_TASK_CORE, g_targetFps);
+}
+
+void setTargetFps(uint16_t targetFps)
+{
+  g_targetFps = max<uint16_t>(targetFps, 1);
+  g_stats.targetFps = g_targetFps;
+}
+
+Stats getStats() { return g_stats; }
+
+void resetStats()
+{
+  const uint16_t targetFps = g_stats.targetFps;
+  g_stats = {};
+  g_stats.targetFps = targetFps;
+}
+
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * RenderTask - Fixed frame clock for composing and pushing frames to the panel
+ *
+ * Runs the frame callback in its own FreeRTOS task pinned to the application core, away from
+ * WiFi and AsyncTCP, so slow housekeeping in loop() can no longer stall the display.
+ */
+namespace RenderTask {
+
+typedef void (*FrameCallback)();
+
+struct Stats {
+  uint32_t frames;
+  uint32_t overruns; // frames that took longer than the frame period
+  uint32_t lastFrameMicros;
+  uint32_t maxFrameMicros;
+  uint16_t targetFps;
+};
+
+// Start the render task; frameCallback is invoked once per frame
+void begin(FrameCallback frameCallback, uint16_t targetFps);
+
+void setTargetFps(uint16_t targetFps);
+Stats getStats();
+void resetStats();
+
+}
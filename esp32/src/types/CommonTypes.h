@@ -1,14 +1,20 @@
 #pragma once
 
+#include "../config/settings.h"
 #include <Arduino.h>
 
+// TextItem::font bits: the font, and whether it is drawn anti-aliased where it can be
+static const uint8_t TEXT_FONT_PICO = 1;
+static const uint8_t TEXT_FONT_SMOOTH = 2;
+
+// How a text item is drawn, its text is kept by TextItemPool
 struct TextItem {
-  char text[32];
   uint16_t color;
   int8_t offsetX;
   int8_t offsetY;
   uint8_t align;
   uint8_t size;
   uint8_t line;
-  uint8_t font;
+  uint8_t font; // TEXT_FONT_* bits, 0 for the regular 1 bit font
+  uint16_t scroll; // marquee speed in pixels per second, 0 for static text
 };
@@ -0,0 +1,119 @@
+#include "ActionRegistry.h"
+
+namespace ActionRegistry {
+
+static Action g_actions[MAX_ACTIONS];
+static uint8_t g_count = 0;
+// Index + 1 of the action with each opcode, 0 if the opcode is free
+static uint8_t g_opcodeIndex[256];
+static uint32_t g_unknown = 0;
+
+// Index of the first action whose name is not less than name
+static uint8_t lowerBound(const char* name)
+{
+  uint8_t low = 0;
+  uint8_t high = g_count;
+
+  while (low < high) {
+    const uint8_t middle = (low + high) / 2;
+    if (strcmp(g_actions[middle].name, name) < 0) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+
+  return low;
+}
+
+static Action* findByName(const char* name)
+{
+  const uint8_t index = lowerBound(name);
+  if (index < g_count && strcmp(g_actions[index].name, name) == 0) {
+    return &g_actions[index];
+  }
+  return nullptr;
+}
+
+static void rebuildOpcodeIndex()
+{
+  memset(g_opcodeIndex, 0, sizeof(g_opcodeIndex));
+  for (uint8_t i = 0; i < g_count; i++) {
+    if (g_actions[i].opcode != NO_OPCODE) {
+      g_opcodeIndex[g_actions[i].opcode] = i + 1;
+    }
+  }
+}
+
+bool registerAction(const char* name, uint8_t opcode, ActionHandler handler, uint8_t flags)
+{
+  if (g_count == MAX_ACTIONS || findByName(name) != nullptr
+      || (opcode != NO_OPCODE && g_opcodeIndex[opcode] != 0)) {
+    Serial.printf("ERROR: Cannot register action %s (opcode %u)\n", name, opcode);
+    return false;
+  }
+
+  // Registration only happens at startup, shifting the sorted array is fine
+  const uint8_t index = lowerBound(name);
+  memmove(&g_actions[index + 1], &g_actions[index], (g_count - index) * sizeof(Action));
+  g_actions[index] = { name, opcode, flags, handler, {} };
+  g_count++;
+
+  rebuildOpcodeIndex();
+  return true;
+}
+
+const Action* find(JsonDocument& doc)
+{
+  Action* action = nullptr;
+
+  if (doc["op"].is<uint8_t>()) {
+    const uint8_t slot = g_opcodeIndex[doc["op"].as<uint8_t>()];
+    action = slot ? &g_actions[slot - 1] : nullptr;
+  } else if (doc["action"].is<const char*>()) {
+    action = findByName(doc["action"]);
+  }
+
+  if (action == nullptr) {
+    g_unknown++;
+    Serial.printf("Unknown action: %s (op %d)\n", doc["action"] | "-", doc["op"] | -1);
+  }
+
+  return action;
+}
+
+bool run(const Action* action, AsyncWebSocketClient* client, JsonDocument& doc)
+{
+  const uint32_t start = micros();
+  const bool ok = action->handler(client, doc);
+  const uint32_t elapsed = micros() - start;
+
+  // Stats are only written by the task running the handlers
+  ActionStats& stats = g_actions[action - g_actions].stats;
+  stats.calls++;
+  stats.totalMicros += elapsed;
+  if (elapsed > stats.maxMicros) {
+    stats.maxMicros = elapsed;
+  }
+  if (!ok) {
+    stats.errors++;
+  }
+
+  return ok;
+}
+
+uint8_t getCount() { return g_count; }
+
+const Action& getAction(uint8_t index) { return g_actions[index]; }
+
+uint32_t getUnknownCount() { return g_unknown; }
+
+void resetStats()
+{
+  for (uint8_t i = 0; i < g_count; i++) {
+    g_actions[i].stats = {};
+  }
+  g_unknown = 0;
+}
+
+}
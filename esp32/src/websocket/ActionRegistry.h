@@ -0,0 +1,66 @@
+#pragma once
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <ESPAsyncWebServer.h>
+
+/**
+ * ActionRegistry - Maps JSON message actions to their handlers
+ *
+ * Actions are kept sorted by name and found by binary search, so dispatching costs a handful of
+ * string compares however many actions there are. An action can also have a numeric opcode;
+ * messages carrying "op" instead of "action" skip the string compares altogether. Subsystems
+ * register their own actions at startup instead of editing a dispatcher.
+ */
+namespace ActionRegistry {
+
+// client is the sender of the message. Returns false if the message could not be applied,
+// which is counted as an error.
+typedef bool (*ActionHandler)(AsyncWebSocketClient* client, JsonDocument& doc);
+
+const uint8_t MAX_ACTIONS = 32;
+// Actions registered with this opcode can only be called by name
+const uint8_t NO_OPCODE = 0;
+// Opcodes below this are taken by the WebSocketHandler's own actions
+const uint8_t FIRST_SUBSYSTEM_OPCODE = 64;
+
+// Action flags
+// A later message with the same action and "layer" makes this one redundant, so it can be
+// dropped when both are waiting for the same frame (fills, brightness, text, ...). Only for
+// actions whose later message replaces the earlier one whether or not its handler succeeds.
+const uint8_t ACTION_COALESCE = 0x01;
+// Replies to the sender. Skipped if the sender is gone; messages are never coalesced across it.
+const uint8_t ACTION_QUERY = 0x02;
+
+struct ActionStats {
+  uint32_t calls;
+  uint32_t errors;
+  uint32_t maxMicros;
+  uint64_t totalMicros;
+};
+
+struct Action {
+  const char* name; // not copied, has to outlive the registry (string literal)
+  uint8_t opcode;
+  uint8_t flags;
+  ActionHandler handler;
+  ActionStats stats;
+};
+
+// Returns false if the name or opcode is already taken or the registry is full
+bool registerAction(const char* name, uint8_t opcode, ActionHandler handler, uint8_t flags = 0);
+
+// The action for doc["op"], or doc["action"] if there is no opcode. nullptr (and counted as
+// unknown) if nothing matches.
+const Action* find(JsonDocument& doc);
+// Runs the action's handler and updates its stats. Returns false if the handler failed.
+bool run(const Action* action, AsyncWebSocketClient* client, JsonDocument& doc);
+
+// Registered actions, sorted by name
+uint8_t getCount();
+const Action& getAction(uint8_t index);
+// Messages whose action or opcode matched nothing
+uint32_t getUnknownCount();
+void resetStats();
+
+}
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * BinaryProtocol - Layout of binary (WS_BINARY) WebSocket messages
+ *
+ * JSON stays the format for commands; binary messages carry bulk pixel data without the hex
+ * text and parse tree. Every message starts with a one byte opcode, all fields are
+ * little-endian (the byte order of both the ESP32 and the browser's typed arrays).
+ */
+namespace BinaryProtocol {
+
+enum Opcode : uint8_t {
+  // Browser -> device: rectangle of raw RGB565 pixels, written straight into a layer
+  OP_BLIT_RGB565 = 0x01,
+  // Browser -> device: numbered batch of single-color horizontal spans, e.g. a brush stroke
+  OP_PIXEL_DELTA = 0x02,
+  // Sender -> device: timestamped full frame for the streaming mode (see FrameStream)
+  OP_STREAM_FRAME = 0x03,
+  // Device -> browser: rows read back from a layer or the composited output
+  OP_PIXELS = 0x81,
+  // Device -> sending browser: what became of the OP_PIXEL_DELTA batch with this sequence number
+  OP_DELTA_ACK = 0x82,
+};
+
+// OP_BLIT_RGB565: [opcode u8][layer u8][x u16][y u16][width u16][height u16]
+// followed by width * height pixels (u16 RGB565), row by row
+struct BlitHeader {
+  uint8_t layer;
+  uint16_t x;
+  uint16_t y;
+  uint16_t width;
+  uint16_t height;
+};
+
+const size_t BLIT_HEADER_SIZE = 10;
+
+inline uint16_t readU16(const uint8_t* data) { return data[0] | (data[1] << 8); }
+
+// Decodes the BLIT_HEADER_SIZE header bytes at data
+inline void readBlitHeader(const uint8_t* data, BlitHeader& header)
+{
+  header.layer = data[1];
+  header.x = readU16(data + 2);
+  header.y = readU16(data + 4);
+  header.width = readU16(data + 6);
+  header.height = readU16(data + 8);
+}
+
+inline size_t blitMessageSize(const BlitHeader& header)
+{
+  return BLIT_HEADER_SIZE + (size_t)header.width * header.height * 2;
+}
+
+// Fills header and returns true if data holds a complete blit message
+inline bool parseBlitHeader(const uint8_t* data, size_t len, BlitHeader& header)
+{
+  if (len < BLIT_HEADER_SIZE || data[0] != OP_BLIT_RGB565) {
+    return false;
+  }
+
+  readBlitHeader(data, header);
+  return len == blitMessageSize(header);
+}
+
+// OP_PIXEL_DELTA: [opcode u8][layer u8][seq u16] followed by spans of
+// [x u16][y u16][length u8][color u16 RGB565]. Batches are kept small enough to arrive in one
+// TCP segment, so the client sizes them to DELTA_MAX_MESSAGE_SIZE.
+const size_t DELTA_HEADER_SIZE = 4;
+const size_t DELTA_SPAN_SIZE = 7;
+const size_t DELTA_MAX_MESSAGE_SIZE = 1024;
+
+struct DeltaSpan {
+  uint16_t x;
+  uint16_t y;
+  uint8_t length;
+  uint16_t color;
+};
+
+// Number of spans in a well formed delta message of len bytes, -1 if malformed
+inline int deltaSpanCount(const uint8_t* data, size_t len)
+{
+  if (len < DELTA_HEADER_SIZE || data[0] != OP_PIXEL_DELTA
+      || (len - DELTA_HEADER_SIZE) % DELTA_SPAN_SIZE != 0) {
+    return -1;
+  }
+  return (len - DELTA_HEADER_SIZE) / DELTA_SPAN_SIZE;
+}
+
+// Decodes span index of a delta message validated by deltaSpanCount
+inline void readDeltaSpan(const uint8_t* data, int index, DeltaSpan& span)
+{
+  const uint8_t* s = data + DELTA_HEADER_SIZE + index * DELTA_SPAN_SIZE;
+  span.x = readU16(s);
+  span.y = readU16(s + 2);
+  span.length = s[4];
+  span.color = readU16(s + 5);
+}
+
+// OP_DELTA_ACK: [opcode u8][seq u16][status u8]
+const size_t DELTA_ACK_SIZE = 4;
+
+enum DeltaStatus : uint8_t {
+  DELTA_APPLIED = 0,
+  // The command queue was full, the batch was not applied and can be sent again
+  DELTA_DROPPED = 1,
+  // Malformed or for a layer that does not exist, sending it again won't help
+  DELTA_REJECTED = 2,
+};
+
+// OP_STREAM_FRAME: [opcode u8][timestamp u32] followed by the whole display, width * height
+// pixels (u16 RGB565), row by row. The timestamp is in milliseconds on the sender's clock; only
+// the differences between frames matter.
+const size_t STREAM_HEADER_SIZE = 5;
+
+inline uint32_t readU32(const uint8_t* data)
+{
+  return data[0] | (data[1] << 8) | (data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+// OP_PIXELS: [opcode u8][source u8][format u8][flags u8][width u16][height u16][y u16][rows u16]
+// followed by rows * width pixels in the given format, row by row. With FLAG_RLE the pixels are
+// sent as [count u8][pixel] runs (count 1..255) that may continue from one row to the next.
+const size_t PIXELS_HEADER_SIZE = 12;
+const uint8_t SOURCE_COMPOSITED = 0xFF; // any other source is a layer index
+
+enum PixelFormat : uint8_t {
+  FORMAT_RGB565 = 0, // u16, little-endian
+  FORMAT_RGB888 = 1, // r, g, b bytes
+};
+
+const uint8_t FLAG_RLE = 0x01;
+
+inline void writeU16(uint8_t* data, uint16_t value)
+{
+  data[0] = value & 0xFF;
+  data[1] = value >> 8;
+}
+
+} // namespace BinaryProtocol
@@ -0,0 +1,102 @@
+#include "BlitStream.h"
+
+BlitStream::BlitStream(MatrixController& matrix)
+    : _matrix(matrix)
+    , _layer(nullptr)
+{
+  begin();
+}
+
+void BlitStream::begin()
+{
+  _layer = nullptr;
+  _headerBytes = 0;
+  _pixelsWritten = 0;
+  _hasSplitPixel = false;
+  _failed = false;
+}
+
+bool BlitStream::isComplete() const
+{
+  return _layer != nullptr && _pixelsWritten == (uint32_t)_blit.width * _blit.height;
+}
+
+bool BlitStream::startBlit()
+{
+  BinaryProtocol::readBlitHeader(_header, _blit);
+  _layer = _matrix.getLayer(_blit.layer);
+
+  if (_header[0] != BinaryProtocol::OP_BLIT_RGB565 || _layer == nullptr
+      || _blit.x >= _layer->getLayerWidth() || _blit.y >= _layer->getLayerHeight()) {
+    Serial.printf("blit: invalid target layer %d at %d,%d\n", _blit.layer, _blit.x, _blit.y);
+    _layer = nullptr;
+    return false;
+  }
+
+  return true;
+}
+
+// Writes count whole pixels, split into one layer call per row they touch
+void BlitStream::writePixels(const uint8_t* data, uint32_t count)
+{
+  while (count > 0) {
+    const uint16_t row = _pixelsWritten / _blit.width;
+    const uint16_t column = _pixelsWritten % _blit.width;
+    const uint32_t run = min<uint32_t>(count, _blit.width - column);
+
+    _layer->writePixels(_blit.x + column, _blit.y + row, data, run);
+
+    data += run * 2;
+    count -= run;
+    _pixelsWritten += run;
+  }
+}
+
+bool BlitStream::feed(const uint8_t* data, size_t len)
+{
+  if (_failed) {
+    return false;
+  }
+
+  // The header itself may be split across chunks
+  if (_headerBytes < BinaryProtocol::BLIT_HEADER_SIZE) {
+    const size_t headerPart = min(len, BinaryProtocol::BLIT_HEADER_SIZE - _headerBytes);
+    memcpy(_header + _headerBytes, data, headerPart);
+    _headerBytes += headerPart;
+    data += headerPart;
+    len -= headerPart;
+
+    if (_headerBytes < BinaryProtocol::BLIT_HEADER_SIZE) {
+      return true;
+    }
+    if (!startBlit()) {
+      _failed = true;
+      return false;
+    }
+  }
+
+  const uint32_t remaining = (uint32_t)_blit.width * _blit.height - _pixelsWritten;
+  if (len + _hasSplitPixel > remaining * 2) {
+    Serial.printf("ERROR: blit carries more than the %ux%u pixels announced\n", _blit.width,
+        _blit.height);
+    _failed = true;
+    return false;
+  }
+
+  // Complete the pixel whose first byte ended the previous chunk
+  if (_hasSplitPixel && len > 0) {
+    _splitPixel[1] = *data++;
+    len--;
+    _hasSplitPixel = false;
+    writePixels(_splitPixel, 1);
+  }
+
+  writePixels(data, len / 2);
+
+  if (len & 1) {
+    _splitPixel[0] = data[len - 1];
+    _hasSplitPixel = true;
+  }
+
+  return true;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "../matrix/MatrixController.h"
+#include "BinaryProtocol.h"
+#include <Arduino.h>
+
+/**
+ * BlitStream - Incremental decoder for OP_BLIT_RGB565 messages
+ *
+ * Large binary messages arrive in TCP sized chunks (and possibly several WebSocket frames).
+ * Instead of reassembling them, every chunk is decoded as it arrives and its pixels are written
+ * straight into the target layer, so memory use does not depend on the image size. The only
+ * state carried between chunks is the header and a pixel split across a chunk boundary.
+ */
+class BlitStream {
+  public:
+  BlitStream(MatrixController& matrix);
+
+  // Starts a new message, dropping whatever was in flight
+  void begin();
+  // Decodes the next chunk of the message. Returns false once the message is malformed; the
+  // rest of it is ignored until the next begin().
+  bool feed(const uint8_t* data, size_t len);
+  // True once every pixel announced by the header has been written
+  bool isComplete() const;
+
+  private:
+  bool startBlit();
+  void writePixels(const uint8_t* data, uint32_t count);
+
+  MatrixController& _matrix;
+  BinaryProtocol::BlitHeader _blit;
+  PixelLayer* _layer;
+  uint8_t _header[BinaryProtocol::BLIT_HEADER_SIZE];
+  uint8_t _headerBytes;
+  uint32_t _pixelsWritten;
+  uint8_t _splitPixel[2];
+  bool _hasSplitPixel;
+  bool _failed;
+};
@@ -0,0 +1,92 @@
+#include "CommandQueue.h"
+
+void Command::release()
+{
+  delete doc;
+  doc = nullptr;
+  free(data);
+  data = nullptr;
+}
+
+bool CommandQueue::push(const Command& command)
+{
+  const uint16_t pendingTail = _pendingTail.load(std::memory_order_relaxed);
+  const uint16_t depth = pendingTail - _head.load(std::memory_order_acquire);
+
+  if (depth >= CAPACITY) {
+    _dropped++;
+    return false;
+  }
+
+  _commands[pendingTail % CAPACITY] = command;
+  _pendingTail.store(pendingTail + 1, std::memory_order_release);
+  if (!isBatchOpen()) {
+    commitBatch();
+  }
+
+  _pushed++;
+  if (depth + 1 > _maxDepth) {
+    _maxDepth = depth + 1;
+  }
+  return true;
+}
+
+void CommandQueue::beginBatch(uint32_t timeout)
+{
+  commitBatch();
+  // The deadline has to be in place before the consumer can see the batch open
+  _batchDeadline.store(millis() + timeout, std::memory_order_relaxed);
+  _batchOpen.store(true, std::memory_order_release);
+}
+
+void CommandQueue::commitBatch()
+{
+  // Publishes everything pushed so far to the consumer. tail moves before the batch closes, so
+  // a consumer that already took an expired batch never sees tail behind what it popped.
+  _tail.store(_pendingTail.load(std::memory_order_relaxed), std::memory_order_release);
+  _batchOpen.store(false, std::memory_order_release);
+}
+
+bool CommandQueue::isBatchExpired() const
+{
+  return _batchOpen.load(std::memory_order_acquire)
+      && (int32_t)(millis() - _batchDeadline.load(std::memory_order_relaxed)) >= 0;
+}
+
+uint16_t CommandQueue::publishedTail() const
+{
+  if (isBatchExpired()) {
+    return _pendingTail.load(std::memory_order_acquire);
+  }
+  return _tail.load(std::memory_order_acquire);
+}
+
+uint16_t CommandQueue::available() const
+{
+  return publishedTail() - _head.load(std::memory_order_relaxed);
+}
+
+bool CommandQueue::pop(Command& command)
+{
+  const uint16_t head = _head.load(std::memory_order_relaxed);
+  if (head == publishedTail()) {
+    return false;
+  }
+
+  command = _commands[head % CAPACITY];
+  // Hands the slot back to the producer
+  _head.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+CommandQueue::Stats CommandQueue::getStats() const
+{
+  Stats stats;
+  // From what the consumer can see, an expired batch may already be popped past tail
+  stats.depth = publishedTail() - _head.load(std::memory_order_acquire);
+  stats.maxDepth = _maxDepth;
+  stats.pushed = _pushed;
+  stats.dropped = _dropped;
+  stats.coalesced = _coalesced;
+  return stats;
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "../config/settings.h"
+#include "ActionRegistry.h"
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <atomic>
+
+/**
+ * CommandQueue - Hands decoded WebSocket messages from the AsyncTCP task to the render task
+ *
+ * Messages are parsed where they arrive, but nothing touches the layers, the text items or the
+ * config until the render task drains the queue at the start of a frame, so a frame is never
+ * composited while a handler is half way through changing it. Single producer (AsyncTCP),
+ * single consumer (render task), no locks: each side only ever moves its own index.
+ *
+ * Commands pushed inside a batch are only published when the batch is committed, so the render
+ * task sees (and applies) all of them in the same frame or none of them. A batch that is still
+ * open at its deadline counts as committed for the render task, so it never holds the queue
+ * back for longer than that; the producer commits it properly on its next message.
+ */
+struct Command {
+  enum Type : uint8_t {
+    JSON, // doc + action
+    BINARY, // complete binary message in data
+    BLIT_CHUNK, // piece of a streamed OP_BLIT_RGB565 message in data
+  };
+
+  // BLIT_CHUNK flags
+  static const uint8_t BLIT_FIRST = 0x01;
+  static const uint8_t BLIT_LAST = 0x02;
+
+  Type type;
+  uint8_t flags;
+  uint32_t clientId; // looked up again when applied, the client may be gone by then
+  const ActionRegistry::Action* action;
+  JsonDocument* doc; // owned
+  uint8_t* data; // owned
+  size_t length;
+
+  // Frees whatever the command owns
+  void release();
+};
+
+class CommandQueue {
+  public:
+  struct Stats {
+    uint16_t depth; // commands waiting right now
+    uint16_t maxDepth;
+    uint32_t pushed;
+    uint32_t dropped; // queue was full
+    uint32_t coalesced; // skipped because a later command made them redundant
+  };
+
+  // Producer side. On false the queue was full and the command is still the caller's.
+  bool push(const Command& command);
+  // Commits an open batch first. timeout is in ms.
+  void beginBatch(uint32_t timeout);
+  void commitBatch();
+  bool isBatchOpen() const { return _batchOpen.load(std::memory_order_relaxed); }
+  // Open and past its deadline, safe to ask from either side
+  bool isBatchExpired() const;
+
+  // Consumer side. available() is what can be popped right now, committed batches are always
+  // available as a whole.
+  uint16_t available() const;
+  bool pop(Command& command);
+  void countCoalesced() { _coalesced++; }
+
+  Stats getStats() const;
+
+  private:
+  static const uint16_t CAPACITY = COMMAND_QUEUE_SIZE;
+  static_assert((CAPACITY & (CAPACITY - 1)) == 0, "COMMAND_QUEUE_SIZE must be a power of two");
+
+  // What the consumer may pop up to: tail, or pendingTail once an open batch has expired
+  uint16_t publishedTail() const;
+
+  Command _commands[CAPACITY];
+  // Free running, the slot is index % CAPACITY. head is only written by the consumer, tail and
+  // pendingTail only by the producer. Commands of an open batch sit between tail and pendingTail.
+  std::atomic<uint16_t> _head { 0 };
+  std::atomic<uint16_t> _tail { 0 };
+  std::atomic<uint16_t> _pendingTail { 0 };
+  std::atomic<bool> _batchOpen { false };
+  std::atomic<uint32_t> _batchDeadline { 0 }; // millis()
+  uint16_t _maxDepth = 0;
+  uint32_t _pushed = 0;
+  uint32_t _dropped = 0;
+  uint32_t _coalesced = 0;
+};
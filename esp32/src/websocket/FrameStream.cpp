@@ -0,0 +1,243 @@
+#include "FrameStream.h"
+
+FrameStream::FrameStream(MatrixController& matrix)
+    : _matrix(matrix)
+{
+  for (Slot& slot : _slots) {
+    slot.pixels = nullptr;
+    slot.due = 0;
+    slot.state.store(SLOT_FREE, std::memory_order_relaxed);
+  }
+}
+
+// ============================================================================
+// CONSUMER (render task)
+// ============================================================================
+
+bool FrameStream::start(uint8_t layer, uint16_t playoutDelay)
+{
+  if (_matrix.getLayer(layer) == nullptr) {
+    Serial.printf("stream: invalid target layer %d\n", layer);
+    return false;
+  }
+
+  _active.store(false, std::memory_order_release);
+
+  // Only allocated once a stream is used, and kept for the next one
+  for (Slot& slot : _slots) {
+    if (slot.pixels == nullptr) {
+      slot.pixels = (uint8_t*)malloc(FRAME_BYTES);
+      if (slot.pixels == nullptr) {
+        Serial.printf("ERROR: Cannot allocate %u bytes for a stream frame. Free heap: %u bytes\n",
+            FRAME_BYTES, ESP.getFreeHeap());
+        return false;
+      }
+    }
+
+    // Frames of the previous stream are not shown anymore
+    uint8_t ready = SLOT_READY;
+    slot.state.compare_exchange_strong(ready, SLOT_FREE, std::memory_order_acq_rel);
+  }
+
+  _layer = layer;
+  _playoutDelay = playoutDelay;
+  _resync.store(true, std::memory_order_release);
+  _active.store(true, std::memory_order_release);
+
+  Serial.printf("Stream started on layer %d, %u ms playout delay\n", layer, playoutDelay);
+  return true;
+}
+
+void FrameStream::stop()
+{
+  _active.store(false, std::memory_order_release);
+
+  for (Slot& slot : _slots) {
+    uint8_t ready = SLOT_READY;
+    slot.state.compare_exchange_strong(ready, SLOT_FREE, std::memory_order_acq_rel);
+  }
+}
+
+void FrameStream::present(uint32_t now)
+{
+  if (!isActive()) {
+    return;
+  }
+
+  Slot* newest = nullptr;
+
+  for (Slot& slot : _slots) {
+    if (slot.state.load(std::memory_order_acquire) != SLOT_READY
+        || (int32_t)(now - slot.due) < 0) {
+      continue;
+    }
+    uint8_t ready = SLOT_READY;
+    if (!slot.state.compare_exchange_strong(ready, SLOT_PRESENTING, std::memory_order_acq_rel)) {
+      continue;
+    }
+
+    // Only the newest of the frames that are due is worth showing
+    Slot* skipped = &slot;
+    if (newest == nullptr || (int32_t)(slot.due - newest->due) > 0) {
+      skipped = newest;
+      newest = &slot;
+    }
+    if (skipped != nullptr) {
+      _lateAtPresent++;
+      skipped->state.store(SLOT_FREE, std::memory_order_release);
+    }
+  }
+
+  if (newest == nullptr) {
+    return;
+  }
+
+  PixelLayer* layer = _matrix.getLayer(_layer);
+  const uint8_t* row = newest->pixels;
+  for (uint16_t y = 0; y < DisplayGeometry::DISPLAY_HEIGHT; y++) {
+    layer->writePixels(0, y, row, DisplayGeometry::DISPLAY_WIDTH);
+    row += DisplayGeometry::DISPLAY_WIDTH * 2;
+  }
+
+  _presented++;
+  newest->state.store(SLOT_FREE, std::memory_order_release);
+}
+
+// ============================================================================
+// PRODUCER (AsyncTCP task)
+// ============================================================================
+
+// A free slot, or else the one holding the oldest frame that is not due yet
+int8_t FrameStream::acquireSlot()
+{
+  for (uint8_t i = 0; i < STREAM_JITTER_FRAMES; i++) {
+    uint8_t expected = SLOT_FREE;
+    if (_slots[i].state.compare_exchange_strong(
+            expected, SLOT_FILLING, std::memory_order_acq_rel)) {
+      return i;
+    }
+  }
+
+  int8_t oldest = -1;
+  for (uint8_t i = 0; i < STREAM_JITTER_FRAMES; i++) {
+    if (_slots[i].state.load(std::memory_order_acquire) == SLOT_READY
+        && (oldest < 0 || (int32_t)(_slots[i].due - _slots[oldest].due) < 0)) {
+      oldest = i;
+    }
+  }
+
+  _overflow++;
+  uint8_t expected = SLOT_READY;
+  if (oldest >= 0
+      && _slots[oldest].state.compare_exchange_strong(
+          expected, SLOT_FILLING, std::memory_order_acq_rel)) {
+    return oldest;
+  }
+
+  // The render task took it meanwhile, this frame is skipped instead
+  return -1;
+}
+
+void FrameStream::releaseFillSlot()
+{
+  if (_fillSlot >= 0) {
+    _slots[_fillSlot].state.store(SLOT_FREE, std::memory_order_release);
+    _fillSlot = -1;
+  }
+  _bytes = 0;
+}
+
+bool FrameStream::begin(size_t length)
+{
+  releaseFillSlot();
+
+  if (!isActive()) {
+    return false;
+  }
+  if (length != MESSAGE_SIZE) {
+    Serial.printf("ERROR: Stream frame has %u bytes, expected %u\n", length, MESSAGE_SIZE);
+    return false;
+  }
+
+  _fillSlot = acquireSlot();
+  return _fillSlot >= 0;
+}
+
+bool FrameStream::feed(const uint8_t* data, size_t len)
+{
+  if (_fillSlot < 0) {
+    return false;
+  }
+  if (_bytes + len > MESSAGE_SIZE) {
+    Serial.println("ERROR: Stream frame is longer than announced");
+    releaseFillSlot();
+    return false;
+  }
+
+  // The header itself may be split across chunks
+  if (_bytes < BinaryProtocol::STREAM_HEADER_SIZE) {
+    const size_t headerPart = min(len, BinaryProtocol::STREAM_HEADER_SIZE - _bytes);
+    memcpy(_header + _bytes, data, headerPart);
+    _bytes += headerPart;
+    data += headerPart;
+    len -= headerPart;
+  }
+
+  memcpy(_slots[_fillSlot].pixels + _bytes - BinaryProtocol::STREAM_HEADER_SIZE, data, len);
+  _bytes += len;
+
+  if (_bytes == MESSAGE_SIZE) {
+    finishFrame();
+  }
+  return true;
+}
+
+void FrameStream::finishFrame()
+{
+  Slot& slot = _slots[_fillSlot];
+  _fillSlot = -1;
+  _received++;
+
+  if (!isActive()) {
+    slot.state.store(SLOT_FREE, std::memory_order_release);
+    return;
+  }
+
+  const uint32_t now = millis();
+  const uint32_t timestamp = BinaryProtocol::readU32(_header + 1);
+
+  bool resync = _resync.exchange(false, std::memory_order_acq_rel);
+  int32_t lateness = (int32_t)(now - (timestamp + _clockOffset));
+
+  // Far off either way the sender restarted or its clock jumped, start over from this frame
+  if (!resync
+      && (lateness > STREAM_RESYNC_THRESHOLD
+          || -lateness > STREAM_RESYNC_THRESHOLD + _playoutDelay)) {
+    resync = true;
+    _resyncs++;
+  }
+  if (resync) {
+    _clockOffset = (int32_t)(now + _playoutDelay - timestamp);
+    lateness = -(int32_t)_playoutDelay;
+  }
+
+  if (lateness > STREAM_LATE_TOLERANCE) {
+    _lateOnArrival++;
+    slot.state.store(SLOT_FREE, std::memory_order_release);
+    return;
+  }
+
+  slot.due = timestamp + _clockOffset;
+  slot.state.store(SLOT_READY, std::memory_order_release);
+}
+
+FrameStream::Stats FrameStream::getStats() const
+{
+  Stats stats;
+  stats.received = _received;
+  stats.presented = _presented;
+  stats.late = _lateOnArrival + _lateAtPresent;
+  stats.overflow = _overflow;
+  stats.resyncs = _resyncs;
+  return stats;
+}
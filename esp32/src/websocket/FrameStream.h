@@ -0,0 +1,94 @@
+#pragma once
+
+#include "../config/settings.h"
+#include "../matrix/DisplayGeometry.h"
+#include "../matrix/MatrixController.h"
+#include "BinaryProtocol.h"
+#include <Arduino.h>
+#include <atomic>
+
+/**
+ * FrameStream - Jitter buffer for timestamped OP_STREAM_FRAME messages
+ *
+ * Frames are decoded straight into one of STREAM_JITTER_FRAMES slots as they arrive (AsyncTCP
+ * task) and presented by the render task once they are due, so the frame rate follows the
+ * sender's timestamps rather than the network's burstiness. The first frame after start() maps
+ * the sender's clock onto millis() plus the playout delay. A frame that is already late when it
+ * arrives is dropped; of several frames due in the same render frame only the newest is shown.
+ * Only the target layer is replaced, the layers above it (text, clock) keep compositing on top.
+ *
+ * One producer (feeding frames), one consumer (start/stop/present). Each slot is handed between
+ * them through its atomic state, there are no locks.
+ */
+class FrameStream {
+  public:
+  struct Stats {
+    uint32_t received; // complete frames
+    uint32_t presented;
+    uint32_t late; // dropped because they were due before they arrived or were shown
+    uint32_t overflow; // dropped because the buffer was full of frames not due yet
+    uint32_t resyncs; // sender clock re-anchored
+  };
+
+  FrameStream(MatrixController& matrix);
+
+  // Consumer side. start() (re)starts the stream into layer, dropping whatever is buffered, and
+  // allocates the buffer on first use. Returns false if the layer does not exist or the buffer
+  // can't be allocated.
+  bool start(uint8_t layer, uint16_t playoutDelay);
+  void stop();
+  bool isActive() const { return _active.load(std::memory_order_acquire); }
+  // Shows the newest frame that is due at now, if any. Called once per render frame.
+  void present(uint32_t now);
+
+  // Producer side. begin() starts a message of length bytes and returns false if no stream is
+  // running or the length is not a full frame; feed() takes the message chunk by chunk.
+  bool begin(size_t length);
+  bool feed(const uint8_t* data, size_t len);
+
+  Stats getStats() const;
+
+  private:
+  static const size_t FRAME_BYTES
+      = (size_t)DisplayGeometry::DISPLAY_WIDTH * DisplayGeometry::DISPLAY_HEIGHT * 2;
+  static const size_t MESSAGE_SIZE = BinaryProtocol::STREAM_HEADER_SIZE + FRAME_BYTES;
+
+  enum SlotState : uint8_t {
+    SLOT_FREE,
+    SLOT_FILLING, // owned by the producer
+    SLOT_READY, // waiting to be due, either side may take it
+    SLOT_PRESENTING, // owned by the consumer
+  };
+
+  struct Slot {
+    uint8_t* pixels;
+    uint32_t due; // millis()
+    std::atomic<uint8_t> state;
+  };
+
+  int8_t acquireSlot();
+  // Gives the slot of a frame that never completed back
+  void releaseFillSlot();
+  void finishFrame();
+
+  MatrixController& _matrix;
+  Slot _slots[STREAM_JITTER_FRAMES];
+  std::atomic<bool> _active { false };
+  uint8_t _layer = 0;
+  uint16_t _playoutDelay = STREAM_PLAYOUT_DELAY;
+
+  // Producer state
+  std::atomic<bool> _resync { true };
+  int32_t _clockOffset = 0; // sender timestamp -> millis()
+  int8_t _fillSlot = -1;
+  uint8_t _header[BinaryProtocol::STREAM_HEADER_SIZE];
+  size_t _bytes = 0;
+  uint32_t _received = 0;
+  uint32_t _lateOnArrival = 0;
+  uint32_t _overflow = 0;
+  uint32_t _resyncs = 0;
+
+  // Consumer state
+  uint32_t _presented = 0;
+  uint32_t _lateAtPresent = 0;
+};
@@ -0,0 +1,231 @@
+#include "Outbox.h"
+#include "../config/settings.h"
+#include <mutex>
+
+namespace Outbox {
+
+struct Entry {
+  AsyncWebSocketSharedBuffer message;
+  bool binary;
+  MessageKind kind;
+};
+
+struct ClientQueue {
+  bool active;
+  uint32_t id;
+  Entry entries[OUTBOX_QUEUE_LENGTH];
+  uint8_t head;
+  uint8_t count;
+  size_t bytes;
+  // Handed to AsyncWebSocket since its queue for the client was last empty
+  size_t handedBytes;
+  // Last time the client took a message, or had nothing waiting
+  unsigned long lastProgress;
+};
+
+static AsyncWebSocket* g_ws = nullptr;
+static ClientQueue g_clients[OUTBOX_MAX_CLIENTS];
+static Stats g_stats = {};
+// Sends come from the render task, the AsyncTCP task (OTA progress) and loop(). Recursive, as
+// closing a client can report its disconnect right away.
+static std::recursive_mutex g_lock;
+
+static ClientQueue* findQueue(uint32_t id)
+{
+  for (ClientQueue& queue : g_clients) {
+    if (queue.active && queue.id == id) {
+      return &queue;
+    }
+  }
+  return nullptr;
+}
+
+static void clearQueue(ClientQueue& queue)
+{
+  for (Entry& entry : queue.entries) {
+    entry.message.reset();
+  }
+  queue.head = 0;
+  queue.count = 0;
+  queue.bytes = 0;
+  queue.handedBytes = 0;
+  queue.lastProgress = millis();
+}
+
+static ClientQueue* addQueue(uint32_t id)
+{
+  ClientQueue* queue = findQueue(id);
+  if (queue != nullptr) {
+    return queue;
+  }
+
+  for (ClientQueue& slot : g_clients) {
+    if (!slot.active) {
+      clearQueue(slot);
+      slot.active = true;
+      slot.id = id;
+      return &slot;
+    }
+  }
+
+  Serial.printf("ERROR: Outbox full, client #%u gets no messages\n", id);
+  return nullptr;
+}
+
+static bool enqueue(ClientQueue& queue, const AsyncWebSocketSharedBuffer& message, bool binary,
+    MessageKind kind)
+{
+  // An unsent message of the same kind is out of date, replace it where it waits
+  if (kind != KIND_NONE) {
+    for (uint8_t i = 0; i < queue.count; i++) {
+      Entry& entry = queue.entries[(queue.head + i) % OUTBOX_QUEUE_LENGTH];
+      if (entry.kind == kind) {
+        queue.bytes = queue.bytes - entry.message->size() + message->size();
+        entry.message = message;
+        entry.binary = binary;
+        g_stats.coalesced++;
+        return true;
+      }
+    }
+  }
+
+  if (queue.count == OUTBOX_QUEUE_LENGTH
+      || queue.bytes + message->size() > (size_t)OUTBOX_CLIENT_BUDGET) {
+    g_stats.dropped++;
+    return false;
+  }
+
+  if (queue.count == 0) {
+    queue.lastProgress = millis();
+  }
+
+  queue.entries[(queue.head + queue.count) % OUTBOX_QUEUE_LENGTH] = { message, binary, kind };
+  queue.count++;
+  queue.bytes += message->size();
+
+  g_stats.maxQueuedBytes = max(g_stats.maxQueuedBytes, queue.bytes);
+  g_stats.maxQueuedMessages = max(g_stats.maxQueuedMessages, queue.count);
+  return true;
+}
+
+static void flushQueue(ClientQueue& queue)
+{
+  if (g_ws == nullptr) {
+    return;
+  }
+
+  AsyncWebSocketClient* client = g_ws->client(queue.id);
+  if (client == nullptr) {
+    clearQueue(queue);
+    queue.active = false;
+    return;
+  }
+
+  // canSend() only limits the number of messages the library holds, not their size. What was
+  // handed over only counts as gone once the library's queue is empty; until then at most the
+  // budget is handed over (or a single message, which never exceeds it).
+  if (client->queueLen() == 0) {
+    queue.handedBytes = 0;
+  }
+
+  while (queue.count > 0 && client->canSend()) {
+    Entry& entry = queue.entries[queue.head];
+    const size_t size = entry.message->size();
+    if (queue.handedBytes > 0 && queue.handedBytes + size > (size_t)OUTBOX_CLIENT_BUDGET) {
+      break;
+    }
+
+    if (entry.binary) {
+      client->binary(entry.message);
+    } else {
+      client->text(entry.message);
+    }
+
+    queue.bytes -= size;
+    queue.handedBytes += size;
+    entry.message.reset();
+    queue.head = (queue.head + 1) % OUTBOX_QUEUE_LENGTH;
+    queue.count--;
+    queue.lastProgress = millis();
+    g_stats.sent++;
+  }
+
+  if (queue.count == 0) {
+    queue.lastProgress = millis();
+  } else if (millis() - queue.lastProgress > OUTBOX_STALL_TIMEOUT) {
+    Serial.printf("WebSocket client #%u took nothing for %lu ms, closing it\n", queue.id,
+        OUTBOX_STALL_TIMEOUT);
+    clearQueue(queue);
+    queue.active = false;
+    g_stats.shed++;
+    client->close();
+  }
+}
+
+void init(AsyncWebSocket* websocket) { g_ws = websocket; }
+
+void addClient(AsyncWebSocketClient* client)
+{
+  std::lock_guard<std::recursive_mutex> lock(g_lock);
+  addQueue(client->id());
+}
+
+void removeClient(AsyncWebSocketClient* client)
+{
+  std::lock_guard<std::recursive_mutex> lock(g_lock);
+  ClientQueue* queue = findQueue(client->id());
+  if (queue != nullptr) {
+    clearQueue(*queue);
+    queue->active = false;
+  }
+}
+
+AsyncWebSocketSharedBuffer serialize(JsonDocument& doc)
+{
+  AsyncWebSocketSharedBuffer buffer = std::make_shared<std::vector<uint8_t>>(measureJson(doc));
+  serializeJson(doc, buffer->data(), buffer->size());
+  return buffer;
+}
+
+bool send(AsyncWebSocketClient* client, AsyncWebSocketSharedBuffer message, bool binary,
+    MessageKind kind)
+{
+  std::lock_guard<std::recursive_mutex> lock(g_lock);
+
+  ClientQueue* queue = addQueue(client->id());
+  if (queue == nullptr || !enqueue(*queue, message, binary, kind)) {
+    return false;
+  }
+
+  flushQueue(*queue);
+  return true;
+}
+
+void broadcast(AsyncWebSocketSharedBuffer message, bool binary, MessageKind kind)
+{
+  std::lock_guard<std::recursive_mutex> lock(g_lock);
+
+  for (ClientQueue& queue : g_clients) {
+    if (queue.active && enqueue(queue, message, binary, kind)) {
+      flushQueue(queue);
+    }
+  }
+}
+
+void flush()
+{
+  std::lock_guard<std::recursive_mutex> lock(g_lock);
+  for (ClientQueue& queue : g_clients) {
+    if (queue.active) {
+      flushQueue(queue);
+    }
+  }
+}
+
+Stats getStats()
+{
+  std::lock_guard<std::recursive_mutex> lock(g_lock);
+  return g_stats;
+}
+
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <ESPAsyncWebServer.h>
+
+/**
+ * Outbox - Per-client outbound message queues with a byte budget
+ *
+ * Messages are only handed to AsyncWebSocket when the client can take them (canSend()) and the
+ * bytes the library holds for it stay within the per-client budget, so a slow client no longer
+ * fills the socket's own queue and drains the heap. Until then they wait here, within the same
+ * budget. State-like messages (settings, update progress) replace
+ * their older, unsent copy instead of piling up, and a client that takes nothing for
+ * OUTBOX_STALL_TIMEOUT is closed; the browser reconnects and fetches the state afresh.
+ *
+ * Safe to use from any task.
+ */
+namespace Outbox {
+
+// Messages of the same kind supersede each other, only the latest unsent one is kept
+enum MessageKind : uint8_t {
+  KIND_NONE = 0, // never coalesced (pixel bands, acks)
+  KIND_STATE,
+  KIND_UPDATE_PROGRESS,
+  KIND_ACTION_STATS,
+  KIND_STREAM_STATS,
+};
+
+struct Stats {
+  uint32_t sent;
+  uint32_t coalesced;
+  uint32_t dropped; // over a client's budget
+  uint32_t shed; // clients closed for not taking anything
+  size_t maxQueuedBytes; // high-water mark of a single client's queue
+  uint8_t maxQueuedMessages;
+};
+
+void init(AsyncWebSocket* websocket);
+
+// Client tracking, from the WebSocket connect/disconnect events
+void addClient(AsyncWebSocketClient* client);
+void removeClient(AsyncWebSocketClient* client);
+
+// Serializes doc once; the buffer is shared by every client it is queued for
+AsyncWebSocketSharedBuffer serialize(JsonDocument& doc);
+
+// Queue a message for one client or for all of them. Returns false if it had to be dropped.
+bool send(AsyncWebSocketClient* client, AsyncWebSocketSharedBuffer message, bool binary,
+    MessageKind kind = KIND_NONE);
+void broadcast(AsyncWebSocketSharedBuffer message, bool binary, MessageKind kind = KIND_NONE);
+
+// Hands queued messages to the clients that can take them and sheds stalled clients. Called
+// after every send and periodically from loop().
+void flush();
+
+Stats getStats();
+
+}
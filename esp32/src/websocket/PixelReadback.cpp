@@ -0,0 +1,88 @@
+#include "PixelReadback.h"
+
+namespace PixelReadback {
+
+static uint8_t bytesPerPixel(const Options& options)
+{
+  return options.format == BinaryProtocol::FORMAT_RGB888 ? 3 : 2;
+}
+
+uint16_t rowsPerMessage(uint16_t width, const Options& options)
+{
+  return max<size_t>(1, TARGET_MESSAGE_SIZE / (width * bytesPerPixel(options)));
+}
+
+size_t maxMessageSize(uint16_t width, uint16_t rows, const Options& options)
+{
+  // Without any repeats RLE spends one count byte per pixel
+  const size_t pixelSize = bytesPerPixel(options) + (options.rle ? 1 : 0);
+  return BinaryProtocol::PIXELS_HEADER_SIZE + (size_t)width * rows * pixelSize;
+}
+
+static uint8_t* writePixel(uint8_t* out, uint16_t color, BinaryProtocol::PixelFormat format)
+{
+  if (format == BinaryProtocol::FORMAT_RGB888) {
+    color565To888(color, out[0], out[1], out[2]);
+    return out + 3;
+  }
+
+  BinaryProtocol::writeU16(out, color);
+  return out + 2;
+}
+
+size_t encode(MatrixController& matrix, const Options& options, uint16_t y, uint16_t rows,
+    uint16_t* scratch, uint8_t* out)
+{
+  const uint16_t width = matrix.getWidth();
+  rows = min<uint16_t>(rows, matrix.getHeight() - y);
+
+  out[0] = BinaryProtocol::OP_PIXELS;
+  out[1] = options.source;
+  out[2] = options.format;
+  out[3] = options.rle ? BinaryProtocol::FLAG_RLE : 0;
+  BinaryProtocol::writeU16(out + 4, width);
+  BinaryProtocol::writeU16(out + 6, matrix.getHeight());
+  BinaryProtocol::writeU16(out + 8, y);
+  BinaryProtocol::writeU16(out + 10, rows);
+
+  uint8_t* cursor = out + BinaryProtocol::PIXELS_HEADER_SIZE;
+  PixelLayer* layer = matrix.getLayer(options.source);
+  uint8_t runLength = 0;
+  uint16_t runColor = 0;
+
+  for (uint16_t row = y; row < y + rows; row++) {
+    const uint16_t* pixels;
+    if (layer) {
+      pixels = layer->getRow(row);
+    } else {
+      matrix.readCompositedRow(row, scratch);
+      pixels = scratch;
+    }
+
+    if (!options.rle) {
+      for (uint16_t x = 0; x < width; x++) {
+        cursor = writePixel(cursor, pixels[x], options.format);
+      }
+      continue;
+    }
+
+    for (uint16_t x = 0; x < width; x++) {
+      if (runLength > 0 && (pixels[x] != runColor || runLength == 255)) {
+        *cursor++ = runLength;
+        cursor = writePixel(cursor, runColor, options.format);
+        runLength = 0;
+      }
+      runColor = pixels[x];
+      runLength++;
+    }
+  }
+
+  if (runLength > 0) {
+    *cursor++ = runLength;
+    cursor = writePixel(cursor, runColor, options.format);
+  }
+
+  return cursor - out;
+}
+
+} // namespace PixelReadback
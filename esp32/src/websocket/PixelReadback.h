@@ -0,0 +1,34 @@
+#pragma once
+
+#include "../matrix/MatrixController.h"
+#include "BinaryProtocol.h"
+#include <Arduino.h>
+
+/**
+ * PixelReadback - Encodes OP_PIXELS messages from a layer or the composited output
+ *
+ * Pixels are written straight into the caller's message buffer, one row at a time, so reading
+ * back a frame costs no allocation beyond that buffer and a row of scratch space.
+ */
+namespace PixelReadback {
+
+struct Options {
+  uint8_t source = 0; // layer index or BinaryProtocol::SOURCE_COMPOSITED
+  BinaryProtocol::PixelFormat format = BinaryProtocol::FORMAT_RGB565;
+  bool rle = true;
+};
+
+// Messages are split into bands of rows of about this many bytes (before RLE)
+const size_t TARGET_MESSAGE_SIZE = 4096;
+
+uint16_t rowsPerMessage(uint16_t width, const Options& options);
+
+// Worst case size of a message with the given number of rows
+size_t maxMessageSize(uint16_t width, uint16_t rows, const Options& options);
+
+// Encodes rows y..y+rows-1 into out and returns the message length. scratch has to hold one
+// row of pixels and is only used for the composited source.
+size_t encode(MatrixController& matrix, const Options& options, uint16_t y, uint16_t rows,
+    uint16_t* scratch, uint8_t* out);
+
+} // namespace PixelReadback
@@ -1,8 +1,16 @@
 #include "WebSocketHandler.h"
+#include "ActionRegistry.h"
+#include "BinaryProtocol.h"
+#include "BlitStream.h"
+#include "CommandQueue.h"
+#include "FrameStream.h"
+#include "Outbox.h"
+#include "PixelReadback.h"
 #include "../config/ConfigManager.h"
 #include "../config/settings.h"
 #include "../data/CustomDataHandler.h"
 #include "../display/TextDisplayHandler.h"
+#include "../display/TextItemPool.h"
 #include "../matrix/MatrixController.h"
 #include "../utils/utils.h"
 #include "SPIFFS.h"
@@ -28,30 +36,50 @@ namespace WebSocketHandler {
 static ConfigManager& config = ConfigManager::getInstance();
 
 static MatrixController* matrix = nullptr;
-static TextItem* textContent = nullptr;
+static TextItemPool* textItems = nullptr;
 static AsyncWebSocket* ws = nullptr;
+// Reassembly buffer for JSON messages split over several packets. Only allocated (to the
+// message's size) while such a message is in flight.
 static char* socketData = nullptr;
-static int* currSocketBufferIndex = nullptr;
-static int socketBufferSize = 0;
+static int socketDataLength = 0;
+static int maxTextMessageSize = 0;
+// Blits are decoded as they stream in and never reassembled. Small binary messages (pixel
+// deltas) that still got split are collected in a fixed buffer.
+static BlitStream* blitStream = nullptr;
+static bool blitStreamActive = false;
+static uint8_t smallBinaryData[BinaryProtocol::DELTA_MAX_MESSAGE_SIZE];
+static size_t smallBinaryLength = 0;
+static bool smallBinaryActive = false;
+// Stream frames skip the command queue, the jitter buffer hands them to the render task
+static FrameStream* frameStream = nullptr;
+static bool frameStreamActive = false;
 static TextDisplayHandler* textDisplay = nullptr;
 static CustomDataHandler* customData = nullptr;
+// Decoded messages on their way from the AsyncTCP task to the render task
+static CommandQueue commandQueue;
+// Client whose applyScene is waiting for its image, while the queue holds back the scene's batch
+static uint32_t sceneClientId = 0;
+
+void registerBuiltinActions();
 
 // ============================================================================
 // INITIALIZATION
 // ============================================================================
 
-void init(MatrixController* matrixCtrl, TextItem* textItems, AsyncWebSocket* websocket,
-    char* socketBuffer, int* bufferIndex, const int bufferSize,
-    TextDisplayHandler* textDisplayHandler, CustomDataHandler* customDataHandler)
+void init(MatrixController* matrixCtrl, TextItemPool* textItemPool, AsyncWebSocket* websocket,
+    const int maxTextSize, TextDisplayHandler* textDisplayHandler,
+    CustomDataHandler* customDataHandler)
 {
   matrix = matrixCtrl;
-  textContent = textItems;
+  textItems = textItemPool;
   ws = websocket;
-  socketData = socketBuffer;
-  currSocketBufferIndex = bufferIndex;
-  socketBufferSize = bufferSize;
+  maxTextMessageSize = maxTextSize;
+  blitStream = new BlitStream(*matrix);
+  frameStream = new FrameStream(*matrix);
   textDisplay = textDisplayHandler;
   customData = customDataHandler;
+  Outbox::init(ws);
+  registerBuiltinActions();
 
   Serial.println("WebSocketHandler initialized");
 }
@@ -62,18 +90,39 @@ void init(MatrixController* matrixCtrl, TextItem* textItems, AsyncWebSocket* web
 
 void resetBuffer()
 {
-  *currSocketBufferIndex = 0;
-  if (socketData != nullptr) {
-    socketData[0] = '\0';
+  free(socketData);
+  socketData = nullptr;
+  socketDataLength = 0;
+}
+
+// Indexed by BlendMode
+static const char* blendModeNames[] = { "normal", "add", "multiply", "mask" };
+
+// Drawing operations target the background layer unless the message names another one
+PixelLayer* getTargetLayer(JsonDocument& doc)
+{
+  if (doc["layer"].is<int>()) {
+    PixelLayer* layer = matrix->getLayer(doc["layer"].as<int>());
+    if (layer == nullptr) {
+      Serial.printf("Unknown layer: %d\n", doc["layer"].as<int>());
+    }
+    return layer;
   }
+
+  return &matrix->getBackgroundLayer();
 }
 
 // ============================================================================
 // MESSAGE HANDLERS - Drawing Operations
 // ============================================================================
 
-void handleDrawPixel(JsonDocument& doc)
+bool handleDrawPixel(AsyncWebSocketClient* client, JsonDocument& doc)
 {
+  PixelLayer* layer = getTargetLayer(doc);
+  if (layer == nullptr) {
+    return false;
+  }
+
   JsonArray data = doc["data"].as<JsonArray>();
 
   for (JsonVariant d : data) {
@@ -81,92 +130,206 @@ void handleDrawPixel(JsonDocument& doc)
     const uint16_t y = d["p"][1];
     const char* color = d["c"];
     const uint16_t c = strtol(color, NULL, 16);
-    matrix->getBackgroundLayer().drawPixel(x, y, c);
+    layer->drawPixel(x, y, c);
   }
+  return true;
 }
 
-void handleDrawImage(JsonDocument& doc)
+bool handleDrawImage(AsyncWebSocketClient* client, JsonDocument& doc)
 {
+  PixelLayer* layer = getTargetLayer(doc);
+  if (layer == nullptr) {
+    return false;
+  }
+
   JsonArray data = doc["data"].as<JsonArray>();
-  int row = 0;
-  int index = 0;
+  const int width = matrix->getWidth();
+  int x = 0;
+  int y = 0;
 
   for (JsonVariant d : data) {
-    int x = index % 64;
-    int y = row;
-
     const uint16_t c = strtol(d, NULL, 16);
-    matrix->getBackgroundLayer().drawPixel(x, y, c);
+    layer->drawPixel(x, y, c);
 
-    if (x == 63) {
-      row++;
+    if (++x == width) {
+      x = 0;
+      y++;
     }
-    index++;
   }
+  return true;
 }
 
-void handleClear(JsonDocument& doc)
+bool handleClear(AsyncWebSocketClient* client, JsonDocument& doc)
 {
+  if (doc["layer"].is<int>()) {
+    PixelLayer* layer = getTargetLayer(doc);
+    if (layer == nullptr) {
+      return false;
+    }
+    layer->clear();
+    return true;
+  }
+
   matrix->getBackgroundLayer().clear();
   matrix->getTextLayer().clear();
+  return true;
 }
 
-void handleFill(JsonDocument& doc)
+bool handleFill(AsyncWebSocketClient* client, JsonDocument& doc)
 {
+  PixelLayer* layer = getTargetLayer(doc);
+  if (layer == nullptr) {
+    return false;
+  }
+
   const char* color = doc["color"];
   const uint16_t c = strtol(color, NULL, 16);
-  matrix->getBackgroundLayer().fillScreen(c);
+  layer->fillScreen(c);
+  return true;
+}
+
+// ============================================================================
+// MESSAGE HANDLERS - Layer Operations
+// ============================================================================
+
+bool handleSetLayer(AsyncWebSocketClient* client, JsonDocument& doc)
+{
+  const int id = doc["layer"] | -1;
+  if (id < 0 || id >= matrix->getLayerCount()) {
+    Serial.printf("setLayer: invalid layer %d\n", id);
+    return false;
+  }
+
+  LayerProperties properties = matrix->getLayerProperties(id);
+
+  if (doc["visible"].is<bool>()) {
+    properties.visible = doc["visible"];
+  }
+  if (doc["opacity"].is<int>()) {
+    properties.opacity = constrain(doc["opacity"].as<int>(), 0, 255);
+  }
+  if (doc["blend"].is<const char*>()) {
+    const char* blend = doc["blend"];
+    for (uint8_t i = 0; i < sizeof(blendModeNames) / sizeof(blendModeNames[0]); i++) {
+      if (isStringEqual(blend, blendModeNames[i])) {
+        properties.blendMode = static_cast<BlendMode>(i);
+      }
+    }
+  }
+
+  matrix->setLayerProperties(id, properties);
+  broadcastConfigUpdate();
+  return true;
 }
 
 // ============================================================================
 // MESSAGE HANDLERS - Text and Clock Operations
 // ============================================================================
 
-void handleToggleClock(JsonDocument& doc)
+bool handleToggleClock(AsyncWebSocketClient* client, JsonDocument& doc)
 {
   matrix->getTextLayer().clear();
   lastshowText = showText;
   showText = doc["visible"];
+  return true;
 }
 
-void handleSetText(JsonDocument& doc)
+// Takes the fields t has, the others keep their value
+void applyTextStyle(JsonVariant t, TextItem& style)
 {
-  JsonArray text = doc["text"].as<JsonArray>();
-  int index = 0;
+  style.offsetX = t["offsetX"] | style.offsetX;
+  style.offsetY = t["offsetY"] | style.offsetY;
+  style.size = t["size"] | style.size;
+  style.align = t["align"] | style.align;
+  style.line = t["line"] | style.line;
+  style.font = t["font"] | style.font;
+  style.scroll = t["scroll"] | style.scroll;
+
+  if (t["color"].is<const char*>()) {
+    style.color = strtol(t["color"], NULL, 16);
+  }
+}
 
-  memset(textContent, 0, sizeof(TextItem) * 5);
+// Replaces all text items. Items without an id get the lowest unused one, so resending the same
+// list keeps the ids (and whatever is drawn for them).
+bool applyText(JsonArray text)
+{
+  bool ok = true;
+
+  textItems->clear();
 
   for (JsonVariant t : text) {
-    textContent[index].offsetX = t["offsetX"].as<signed short>();
-    textContent[index].offsetY = t["offsetY"].as<signed short>();
-    textContent[index].size = t["size"].as<signed short>();
-    textContent[index].align = t["align"].as<signed short>();
-    textContent[index].line = t["line"].as<signed short>();
-    textContent[index].font = t["font"].as<signed short>();
-    strlcpy(textContent[index].text, t["text"], sizeof(textContent[index].text));
+    TextItem style = {};
+    applyTextStyle(t, style);
+
+    if (textItems->set(t["id"] | 0, t["text"] | "", style) == 0) {
+      Serial.printf("setText: no room for text item %u\n", (unsigned)textItems->count());
+      ok = false;
+    }
+  }
 
-    const uint16_t c = strtol(t["color"], NULL, 16);
-    textContent[index].color = c;
+  return ok;
+}
+
+bool handleSetText(AsyncWebSocketClient* client, JsonDocument& doc)
+{
+  return applyText(doc["text"].as<JsonArray>());
+}
 
-    ++index;
+// Changes the fields given for one item, or adds it (to the top) if its id is new
+bool handleUpdateText(AsyncWebSocketClient* client, JsonDocument& doc)
+{
+  const uint16_t id = doc["id"] | 0;
+  if (id == 0) {
+    Serial.println("updateText: missing id");
+    return false;
   }
+
+  const int index = textItems->find(id);
+  TextItem style = {};
+  if (index >= 0) {
+    style = textItems->getStyle(index);
+  } else {
+    style.color = 0xFFFF;
+    style.size = 1;
+  }
+  applyTextStyle(doc.as<JsonVariant>(), style);
+
+  if (textItems->set(id, doc["text"].as<const char*>(), style) == 0) {
+    Serial.printf("updateText: no room for text item %u\n", id);
+    return false;
+  }
+  return true;
+}
+
+bool handleRemoveText(AsyncWebSocketClient* client, JsonDocument& doc)
+{
+  const uint16_t id = doc["id"] | 0;
+  if (!textItems->remove(id)) {
+    Serial.printf("removeText: unknown text item %u\n", id);
+    return false;
+  }
+  return true;
 }
 
 // ============================================================================
 // MESSAGE HANDLERS - Configuration Operations
 // ============================================================================
 
-void handleCompositionMode(JsonDocument& doc)
+// The apply* functions below change a setting without persisting or announcing it, so a scene
+// can change several of them with a single config.save() and broadcast
+
+bool handleCompositionMode(AsyncWebSocketClient* client, JsonDocument& doc)
 {
   int mode = doc["mode"];
   config.setCompositionMode(mode);
   config.save();
   broadcastConfigUpdate();
+  return true;
 }
 
-void handleSetBrightness(JsonDocument& doc)
+void applyBrightness(int brightness)
 {
-  int brightness = doc["brightness"].as<int>();
   int clampedBrightness = max(MIN_BRIGHTNESS, min(brightness, MAX_BRIGHTNESS));
 
   if (brightness < MIN_BRIGHTNESS) {
@@ -179,11 +342,17 @@ void handleSetBrightness(JsonDocument& doc)
 
   config.setBrightness(clampedBrightness);
   matrix->setBrightness(clampedBrightness);
+}
+
+bool handleSetBrightness(AsyncWebSocketClient* client, JsonDocument& doc)
+{
+  applyBrightness(doc["brightness"].as<int>());
   config.save();
   broadcastConfigUpdate();
+  return true;
 }
 
-void handleSetTimeZone(JsonDocument& doc)
+bool handleSetTimeZone(AsyncWebSocketClient* client, JsonDocument& doc)
 {
   const char* tz = doc["timezone"];
   config.setTimezone(tz);
@@ -192,9 +361,10 @@ void handleSetTimeZone(JsonDocument& doc)
   config.save();
   broadcastConfigUpdate();
   Serial.printf("Timezone updated to: %s\n", tz);
+  return true;
 }
 
-void handleSetLocale(JsonDocument& doc)
+bool handleSetLocale(AsyncWebSocketClient* client, JsonDocument& doc)
 {
   const char* loc = doc["locale"];
   config.setLocale(loc);
@@ -204,12 +374,12 @@ void handleSetLocale(JsonDocument& doc)
   config.save();
   broadcastConfigUpdate();
   Serial.printf("Locale updated to: %s\n", loc);
+  return true;
 }
 
-void handleCustomData(JsonDocument& doc)
+// Returns false (and changes nothing) if custom data is enabled without a server
+bool applyCustomData(JsonObject customDataObj)
 {
-  JsonObject customDataObj = doc["options"].as<JsonObject>();
-
   if (customDataObj["updateInterval"] != 0 && customDataObj["updateInterval"] >= -1) {
     int interval = customDataObj["updateInterval"];
 
@@ -233,11 +403,11 @@ void handleCustomData(JsonDocument& doc)
       customDataUpdateInterval = interval;
       strlcpy(customDataServer, serverUrl.c_str(), sizeof(customDataServer));
 
-      config.save();
-      broadcastConfigUpdate();
       Serial.println("Enabled custom data");
       Serial.println(serverUrl);
+      return true;
     }
+    return false;
   } else {
     // Disable custom data
     config.setCustomDataEnabled(false);
@@ -245,61 +415,202 @@ void handleCustomData(JsonDocument& doc)
       customData->setEnabled(false);
     }
     customDataEnabled = false;
-    config.save();
-    broadcastConfigUpdate();
     Serial.println("Disabled custom data");
   }
+  return true;
+}
+
+bool handleCustomData(AsyncWebSocketClient* client, JsonDocument& doc)
+{
+  if (!applyCustomData(doc["options"].as<JsonObject>())) {
+    return false;
+  }
+
+  config.save();
+  broadcastConfigUpdate();
+  return true;
+}
+
+// ============================================================================
+// MESSAGE HANDLERS - Scenes
+// ============================================================================
+
+// Applies a saved layout in one go: text items and settings, persisted with a single
+// config.save() and announced with a single broadcast. With "image": true the blit that follows
+// from the same client is queued together with this message (see queueJson), so text, settings
+// and image all change in the same frame.
+bool handleApplyScene(AsyncWebSocketClient* client, JsonDocument& doc)
+{
+  bool ok = true;
+
+  if (doc["text"].is<JsonArray>()) {
+    ok = applyText(doc["text"].as<JsonArray>());
+  }
+  if (doc["customData"].is<JsonObject>()) {
+    ok = applyCustomData(doc["customData"].as<JsonObject>()) && ok;
+  }
+  if (doc["compositionMode"].is<int>()) {
+    config.setCompositionMode(doc["compositionMode"].as<int>());
+  }
+  if (doc["brightness"].is<int>()) {
+    applyBrightness(doc["brightness"].as<int>());
+  }
+
+  config.save();
+  broadcastConfigUpdate();
+  return ok;
 }
 
 // ============================================================================
 // MESSAGE HANDLERS - Query Operations
 // ============================================================================
 
-void handleGetPixels(JsonDocument& doc) { sendPixels(); }
+void sendPixels(AsyncWebSocketClient* client, const PixelReadback::Options& options);
+
+// Queries are answered to the asking client only.
+// Pixels are read back from the background layer unless the message asks for another layer or
+// for the composited output ("composited": true)
+bool handleGetPixels(AsyncWebSocketClient* client, JsonDocument& doc)
+{
+  PixelReadback::Options options;
+
+  if (doc["composited"] | false) {
+    options.source = BinaryProtocol::SOURCE_COMPOSITED;
+  } else if (getTargetLayer(doc) == nullptr) {
+    return false;
+  } else {
+    options.source = doc["layer"] | 0;
+  }
+
+  if (isStringEqual(doc["format"] | "rgb565", "rgb888")) {
+    options.format = BinaryProtocol::FORMAT_RGB888;
+  }
+  options.rle = doc["rle"] | true;
 
-void handleGetState(JsonDocument& doc) { sendState(); }
+  sendPixels(client, options);
+  return true;
+}
 
-void handleReset(JsonDocument& doc) { resetWifi(); }
+bool handleGetState(AsyncWebSocketClient* client, JsonDocument& doc)
+{
+  sendState(client);
+  return true;
+}
+
+bool handleReset(AsyncWebSocketClient* client, JsonDocument& doc)
+{
+  resetWifi();
+  return true;
+}
+
+// Call counts, errors and handler time per action, to see which actions dominate under load
+bool handleGetActionStats(AsyncWebSocketClient* client, JsonDocument& doc)
+{
+  JsonDocument stats;
+  stats["action"] = "actionStats";
+  stats["unknown"] = ActionRegistry::getUnknownCount();
+
+  JsonArray actionArray = stats["actions"].to<JsonArray>();
+  for (uint8_t i = 0; i < ActionRegistry::getCount(); i++) {
+    const ActionRegistry::Action& action = ActionRegistry::getAction(i);
+    JsonObject actionObject = actionArray.add<JsonObject>();
+    actionObject["name"] = action.name;
+    actionObject["calls"] = action.stats.calls;
+    actionObject["errors"] = action.stats.errors;
+    actionObject["totalMicros"] = action.stats.totalMicros;
+    actionObject["maxMicros"] = action.stats.maxMicros;
+  }
+
+  const CommandQueue::Stats queueStats = commandQueue.getStats();
+  JsonObject queueObject = stats["queue"].to<JsonObject>();
+  queueObject["depth"] = queueStats.depth;
+  queueObject["maxDepth"] = queueStats.maxDepth;
+  queueObject["dropped"] = queueStats.dropped;
+  queueObject["coalesced"] = queueStats.coalesced;
+
+  if (doc["reset"] | false) {
+    ActionRegistry::resetStats();
+  }
+
+  JsonObject outboxObject = stats["outbox"].to<JsonObject>();
+  const Outbox::Stats outboxStats = Outbox::getStats();
+  outboxObject["maxQueuedBytes"] = outboxStats.maxQueuedBytes;
+  outboxObject["maxQueuedMessages"] = outboxStats.maxQueuedMessages;
+  outboxObject["dropped"] = outboxStats.dropped;
+  outboxObject["coalesced"] = outboxStats.coalesced;
+  outboxObject["shed"] = outboxStats.shed;
+
+  Outbox::send(client, Outbox::serialize(stats), false, Outbox::KIND_ACTION_STATS);
+  return true;
+}
+
+bool handleStream(AsyncWebSocketClient* client, JsonDocument& doc)
+{
+  if (!(doc["enabled"] | false)) {
+    frameStream->stop();
+    Serial.println("Stream stopped");
+    return true;
+  }
+
+  const int layer = doc["layer"] | (int)LAYER_BACKGROUND;
+  return frameStream->start(layer, doc["delay"] | STREAM_PLAYOUT_DELAY);
+}
+
+bool handleGetStreamStats(AsyncWebSocketClient* client, JsonDocument& doc)
+{
+  const FrameStream::Stats streamStats = frameStream->getStats();
+
+  JsonDocument stats;
+  stats["action"] = "streamStats";
+  stats["active"] = frameStream->isActive();
+  stats["received"] = streamStats.received;
+  stats["presented"] = streamStats.presented;
+  stats["late"] = streamStats.late;
+  stats["overflow"] = streamStats.overflow;
+  stats["resyncs"] = streamStats.resyncs;
+
+  Outbox::send(client, Outbox::serialize(stats), false, Outbox::KIND_STREAM_STATS);
+  return true;
+}
 
 // ============================================================================
 // SEND FUNCTIONS
 // ============================================================================
 
-void sendPixels()
+void sendPixels(AsyncWebSocketClient* client, const PixelReadback::Options& options)
 {
-  layerPixels* pixels = matrix->getBackgroundLayer().pixels;
-  int linesPerMessage = 4;
+  const uint16_t width = matrix->getWidth();
+  const uint16_t height = matrix->getHeight();
+  const uint16_t rows = PixelReadback::rowsPerMessage(width, options);
 
-  for (int y = 0; y < 32 / linesPerMessage; y++) {
-    JsonDocument doc;
-    JsonArray data = doc["data"].to<JsonArray>();
-    doc["action"] = "matrixPixels";
-    doc["layer"] = "bg";
-    doc["line-start"] = y * linesPerMessage;
-    doc["line-end"] = y * linesPerMessage + linesPerMessage;
+  const size_t maxSize = PixelReadback::maxMessageSize(width, rows, options);
+  uint16_t* scratch = (uint16_t*)malloc(width * sizeof(uint16_t));
 
-    for (int line = 0; line < linesPerMessage; line++) {
-      int currentLine = y * linesPerMessage + line;
-      JsonArray lineData = data.add<JsonArray>();
-
-      for (int x = 0; x < 64; x++) {
-        CRGB pixel = pixels->data[currentLine][x];
+  if (scratch == nullptr) {
+    Serial.printf("ERROR: Not enough memory for pixel readback. Free heap: %u bytes\n",
+        ESP.getFreeHeap());
+    return;
+  }
 
-        if (currentLine == 0 && x == 63) {
-          Serial.printf("Pixel RGB %d %d %d", pixel.r, pixel.g, pixel.b);
-        }
+  // Each band gets its own buffer, it waits in the outbox until the client can take it
+  for (uint16_t y = 0; y < height; y += rows) {
+    AsyncWebSocketSharedBuffer message = std::make_shared<std::vector<uint8_t>>(maxSize);
+    message->resize(PixelReadback::encode(*matrix, options, y, rows, scratch, message->data()));
 
-        lineData.add(convertRgbToHex(pixel.r, pixel.g, pixel.b, true));
-      }
+    if (client == nullptr) {
+      Outbox::broadcast(message, true);
+    } else if (!Outbox::send(client, message, true)) {
+      // Over the client's budget, the rest of the frame would be of no use either
+      break;
     }
-
-    String json;
-    serializeJson(doc, json);
-    ws->textAll(json);
   }
+
+  free(scratch);
 }
 
-void sendState()
+void sendPixels(AsyncWebSocketClient* client) { sendPixels(client, PixelReadback::Options()); }
+
+void sendState(AsyncWebSocketClient* client)
 {
   JsonDocument doc;
   JsonArray textArray = doc["text"].to<JsonArray>();
@@ -314,169 +625,520 @@ void sendState()
   doc["brightness"] = config.getBrightness();
   doc["timezone"] = config.getTimezone();
   doc["locale"] = config.getLocale();
+  doc["width"] = matrix->getWidth();
+  doc["height"] = matrix->getHeight();
+
+  JsonArray layerArray = doc["layers"].to<JsonArray>();
+  for (uint8_t i = 0; i < matrix->getLayerCount(); i++) {
+    const LayerProperties& properties = matrix->getLayerProperties(i);
+    JsonObject layerObject = layerArray.add<JsonObject>();
+    layerObject["visible"] = properties.visible;
+    layerObject["opacity"] = properties.opacity;
+    layerObject["blend"] = blendModeNames[static_cast<uint8_t>(properties.blendMode)];
+  }
 
-  for (int i = 0; i < 5; i++) {
-    if (strcmp(textContent[i].text, "") != 0) {
-      JsonObject textObject = textArray.add<JsonObject>();
-      textObject["text"] = textContent[i].text;
-      textObject["line"] = textContent[i].line;
-      textObject["offsetX"] = textContent[i].offsetX;
-      textObject["offsetY"] = textContent[i].offsetY;
-      textObject["size"] = textContent[i].size;
-      textObject["align"] = textContent[i].align;
-      textObject["font"] = textContent[i].font;
-      textObject["color"] = convert16BitTo32BitHexColor(textContent[i].color);
-    }
+  doc["textCapacity"] = TEXT_ITEM_CAPACITY;
+  for (size_t i = 0; i < textItems->count(); i++) {
+    const TextItem& style = textItems->getStyle(i);
+    JsonObject textObject = textArray.add<JsonObject>();
+    textObject["id"] = textItems->getId(i);
+    textObject["text"] = textItems->getText(i);
+    textObject["line"] = style.line;
+    textObject["offsetX"] = style.offsetX;
+    textObject["offsetY"] = style.offsetY;
+    textObject["size"] = style.size;
+    textObject["align"] = style.align;
+    textObject["font"] = style.font;
+    textObject["scroll"] = style.scroll;
+    textObject["color"] = convert16BitTo32BitHexColor(style.color);
   }
 
-  String json;
-  serializeJson(doc, json);
-  ws->textAll(json);
+  AsyncWebSocketSharedBuffer json = Outbox::serialize(doc);
+  if (client != nullptr) {
+    Outbox::send(client, json, false, Outbox::KIND_STATE);
+  } else {
+    Outbox::broadcast(json, false, Outbox::KIND_STATE);
+  }
 }
 
 void broadcastConfigUpdate()
 {
   if (ws != nullptr) {
-    sendState();
+    sendState(nullptr);
     Serial.println("Config update broadcasted to all WebSocket clients");
   }
 }
 
 // ============================================================================
-// ACTION DISPATCHER
+// ACTION TABLE
 // ============================================================================
 
-void dispatchAction(const char* action, JsonDocument& doc)
+// Opcodes are the optional numeric alternative to "action" ({"op": 4} instead of
+// {"action": "fill"}); they are part of the protocol, never renumber them
+static const struct {
+  const char* name;
+  uint8_t opcode;
+  ActionRegistry::ActionHandler handler;
+  uint8_t flags;
+} builtinActions[] = {
+  // Drawing operations
+  { "drawpixel", 1, handleDrawPixel, 0 },
+  { "drawImage", 2, handleDrawImage, 0 },
+  { "clear", 3, handleClear, ActionRegistry::ACTION_COALESCE },
+  { "fill", 4, handleFill, ActionRegistry::ACTION_COALESCE },
+  // Layer operations
+  { "setLayer", 5, handleSetLayer, 0 },
+  // Text and clock operations
+  { "toggleClock", 6, handleToggleClock, ActionRegistry::ACTION_COALESCE },
+  { "setText", 7, handleSetText, ActionRegistry::ACTION_COALESCE },
+  // Configuration operations
+  { "compositionMode", 8, handleCompositionMode, ActionRegistry::ACTION_COALESCE },
+  { "setBrightness", 9, handleSetBrightness, ActionRegistry::ACTION_COALESCE },
+  { "setTimeZone", 10, handleSetTimeZone, ActionRegistry::ACTION_COALESCE },
+  { "setLocale", 11, handleSetLocale, ActionRegistry::ACTION_COALESCE },
+  // Not coalesced: an invalid later message is rejected and must not cost the valid one before
+  { "customData", 12, handleCustomData, 0 },
+  // Query operations
+  { "getPixels", 13, handleGetPixels, ActionRegistry::ACTION_QUERY },
+  { "getState", 14, handleGetState, ActionRegistry::ACTION_QUERY },
+  { "reset", 15, handleReset, 0 },
+  { "getActionStats", 16, handleGetActionStats, ActionRegistry::ACTION_QUERY },
+  // Scenes
+  { "applyScene", 17, handleApplyScene, 0 },
+  // Frame streaming
+  { "stream", 18, handleStream, 0 },
+  { "getStreamStats", 19, handleGetStreamStats, ActionRegistry::ACTION_QUERY },
+  // Single text items, by id
+  { "updateText", 20, handleUpdateText, 0 },
+  { "removeText", 21, handleRemoveText, 0 },
+};
+
+void registerBuiltinActions()
 {
-  Serial.printf("Processing action: %s\n", action);
+  for (const auto& action : builtinActions) {
+    ActionRegistry::registerAction(action.name, action.opcode, action.handler, action.flags);
+  }
+}
 
-  // Drawing operations
-  if (isStringEqual(action, "drawpixel")) {
-    handleDrawPixel(doc);
-  } else if (isStringEqual(action, "drawImage")) {
-    handleDrawImage(doc);
-  } else if (isStringEqual(action, "clear")) {
-    handleClear(doc);
-  } else if (isStringEqual(action, "fill")) {
-    handleFill(doc);
+// ============================================================================
+// BINARY MESSAGES
+// ============================================================================
+
+void handleBlitRgb565(const uint8_t* data, size_t len)
+{
+  BinaryProtocol::BlitHeader header;
+  if (!BinaryProtocol::parseBlitHeader(data, len, header)) {
+    Serial.printf("ERROR: Malformed blit message (%u bytes)\n", len);
+    return;
   }
-  // Text and clock operations
-  else if (isStringEqual(action, "toggleClock")) {
-    handleToggleClock(doc);
-  } else if (isStringEqual(action, "setText")) {
-    handleSetText(doc);
+
+  PixelLayer* layer = matrix->getLayer(header.layer);
+  if (layer == nullptr || header.x >= layer->getLayerWidth()
+      || header.y >= layer->getLayerHeight()) {
+    Serial.printf("blit: invalid target layer %d at %d,%d\n", header.layer, header.x, header.y);
+    return;
   }
-  // Configuration operations
-  else if (isStringEqual(action, "compositionMode")) {
-    handleCompositionMode(doc);
-  } else if (isStringEqual(action, "setBrightness")) {
-    handleSetBrightness(doc);
-  } else if (isStringEqual(action, "setTimeZone")) {
-    handleSetTimeZone(doc);
-  } else if (isStringEqual(action, "setLocale")) {
-    handleSetLocale(doc);
-  } else if (isStringEqual(action, "customData")) {
-    handleCustomData(doc);
+
+  // Rows are copied as they are, no per-pixel parsing
+  const uint8_t* pixels = data + BinaryProtocol::BLIT_HEADER_SIZE;
+  for (uint16_t row = 0; row < header.height; row++) {
+    layer->writePixels(header.x, header.y + row, pixels, header.width);
+    pixels += header.width * 2;
   }
-  // Query operations
-  else if (isStringEqual(action, "getPixels")) {
-    handleGetPixels(doc);
-  } else if (isStringEqual(action, "getState")) {
-    handleGetState(doc);
-  } else if (isStringEqual(action, "reset")) {
-    handleReset(doc);
-  } else {
-    Serial.printf("Unknown action: %s\n", action);
+}
+
+void sendDeltaAck(
+    AsyncWebSocketClient* client, uint16_t seq, BinaryProtocol::DeltaStatus status)
+{
+  if (client == nullptr) {
+    return;
+  }
+
+  AsyncWebSocketSharedBuffer ack
+      = std::make_shared<std::vector<uint8_t>>(BinaryProtocol::DELTA_ACK_SIZE);
+  (*ack)[0] = BinaryProtocol::OP_DELTA_ACK;
+  BinaryProtocol::writeU16(ack->data() + 1, seq);
+  (*ack)[3] = status;
+  Outbox::send(client, ack, true);
+}
+
+void handlePixelDelta(AsyncWebSocketClient* client, const uint8_t* data, size_t len)
+{
+  const int spanCount = BinaryProtocol::deltaSpanCount(data, len);
+  if (spanCount < 0) {
+    Serial.printf("ERROR: Malformed pixel delta (%u bytes)\n", len);
+    return;
+  }
+
+  const uint16_t seq = BinaryProtocol::readU16(data + 2);
+  PixelLayer* layer = matrix->getLayer(data[1]);
+
+  if (layer == nullptr) {
+    Serial.printf("delta: invalid target layer %d\n", data[1]);
+    sendDeltaAck(client, seq, BinaryProtocol::DELTA_REJECTED);
+    return;
+  }
+
+  BinaryProtocol::DeltaSpan span;
+  for (int i = 0; i < spanCount; i++) {
+    BinaryProtocol::readDeltaSpan(data, i, span);
+    layer->drawFastHLine(span.x, span.y, span.length, span.color);
+  }
+
+  sendDeltaAck(client, seq, BinaryProtocol::DELTA_APPLIED);
+}
+
+void applyBinaryMessage(AsyncWebSocketClient* client, const uint8_t* data, size_t len)
+{
+  switch (data[0]) {
+  case BinaryProtocol::OP_BLIT_RGB565:
+    handleBlitRgb565(data, len);
+    break;
+  case BinaryProtocol::OP_PIXEL_DELTA:
+    handlePixelDelta(client, data, len);
+    break;
+  }
+}
+
+void applyBlitChunk(const Command& command)
+{
+  if (command.flags & Command::BLIT_FIRST) {
+    blitStream->begin();
+  }
+
+  if (blitStream->feed(command.data, command.length) && (command.flags & Command::BLIT_LAST)
+      && !blitStream->isComplete()) {
+    Serial.println("ERROR: blit ended before all announced pixels arrived");
   }
 }
 
 // ============================================================================
-// SINGLE PACKET HANDLER
+// COMMAND QUEUE
 // ============================================================================
 
-bool handleSinglePacket(uint8_t* data, size_t len)
+// Publishes a scene's batch. Usually once its image is queued, but also if the client sends a
+// text message instead, disconnects, the queue runs full or the image takes longer than
+// SCENE_IMAGE_TIMEOUT, so the batch never blocks the queue.
+void endScene()
 {
-  Serial.println("Single packet data");
+  if (commandQueue.isBatchOpen()) {
+    commandQueue.commitBatch();
+  }
+  sceneClientId = 0;
+}
 
-  JsonDocument doc;
-  DeserializationError error = deserializeJson(doc, data, len);
+// Hands a decoded message to the render task. The command is freed if the queue is full.
+bool queueCommand(Command& command)
+{
+  if (commandQueue.push(command)) {
+    return true;
+  }
+
+  Serial.printf("ERROR: Command queue full, dropping message from client #%u\n",
+      command.clientId);
+  command.release();
+  endScene();
+  return false;
+}
+
+bool queueJson(AsyncWebSocketClient* client, JsonDocument* doc)
+{
+  Command command = {};
+  command.type = Command::JSON;
+  command.clientId = client->id();
+  command.doc = doc;
+  command.action = ActionRegistry::find(*doc);
+
+  if (command.action == nullptr) {
+    command.release();
+    return false;
+  }
+
+  // The scene and the image that follows it reach the render task together
+  if (command.action->handler == handleApplyScene && ((*doc)["image"] | false)) {
+    endScene();
+    commandQueue.beginBatch(SCENE_IMAGE_TIMEOUT);
+    sceneClientId = client->id();
+  }
+
+  return queueCommand(command);
+}
+
+// Copies data, the socket reuses its buffer once the callback returns
+bool queueBinary(
+    AsyncWebSocketClient* client, Command::Type type, uint8_t flags, const uint8_t* data, size_t len)
+{
+  Command command = {};
+  command.type = type;
+  command.flags = flags;
+  command.clientId = client->id();
+  command.data = (uint8_t*)malloc(len);
+  command.length = len;
+
+  if (command.data == nullptr) {
+    Serial.printf("ERROR: Cannot allocate %u bytes for message. Free heap: %u bytes\n", len,
+        ESP.getFreeHeap());
+    return false;
+  }
+
+  memcpy(command.data, data, len);
+  return queueCommand(command);
+}
+
+// A command waiting for the same frame as a later one that makes it redundant
+bool isSuperseded(const Command* batch, uint16_t index, uint16_t count)
+{
+  const Command& command = batch[index];
+  if (command.type != Command::JSON || !(command.action->flags & ActionRegistry::ACTION_COALESCE)) {
+    return false;
+  }
+
+  const int layer = (*command.doc)["layer"] | -1;
+
+  for (uint16_t i = index + 1; i < count; i++) {
+    const Command& later = batch[i];
+    if (later.type != Command::JSON) {
+      continue;
+    }
+    // A query in between has to see the earlier command's effect
+    if (later.action->flags & ActionRegistry::ACTION_QUERY) {
+      return false;
+    }
+    if (later.action == command.action && ((*later.doc)["layer"] | -1) == layer) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void applyCommand(Command& command)
+{
+  AsyncWebSocketClient* client = ws->client(command.clientId);
+
+  switch (command.type) {
+  case Command::JSON:
+    if (client == nullptr && (command.action->flags & ActionRegistry::ACTION_QUERY)) {
+      break;
+    }
+    ActionRegistry::run(command.action, client, *command.doc);
+    break;
+  case Command::BINARY:
+    applyBinaryMessage(client, command.data, command.length);
+    break;
+  case Command::BLIT_CHUNK:
+    applyBlitChunk(command);
+    break;
+  }
+}
+
+void applyCommands()
+{
+  // Only touched by the render task
+  static Command batch[COMMAND_QUEUE_SIZE];
+  uint16_t count = 0;
+
+  // Only what is there now, commands arriving meanwhile wait for the next frame
+  const uint16_t available = commandQueue.available();
+  while (count < available && commandQueue.pop(batch[count])) {
+    count++;
+  }
+
+  for (uint16_t i = 0; i < count; i++) {
+    if (isSuperseded(batch, i, count)) {
+      commandQueue.countCoalesced();
+    } else {
+      applyCommand(batch[i]);
+    }
+    batch[i].release();
+  }
+
+  frameStream->present(millis());
+}
+
+CommandQueue::Stats getCommandQueueStats() { return commandQueue.getStats(); }
+
+FrameStream::Stats getFrameStreamStats() { return frameStream->getStats(); }
+
+// ============================================================================
+// SINGLE PACKET HANDLERS
+// ============================================================================
+
+bool handleSinglePacket(AsyncWebSocketClient* client, uint8_t* data, size_t len)
+{
+  JsonDocument* doc = new JsonDocument();
+  DeserializationError error = deserializeJson(*doc, data, len);
 
   if (error) {
     Serial.printf("deserializeJson() failed: %s\n", error.c_str());
+    delete doc;
     return false;
   }
 
-  const char* action = doc["action"];
-  Serial.printf("Websocket message received: %s\n", action);
+  return queueJson(client, doc);
+}
 
-  dispatchAction(action, doc);
-  return true;
+bool handleBinaryMessage(AsyncWebSocketClient* client, const uint8_t* data, size_t len)
+{
+  if (len == 0) {
+    return false;
+  }
+
+  switch (data[0]) {
+  case BinaryProtocol::OP_BLIT_RGB565:
+    return queueBinary(client, Command::BINARY, 0, data, len);
+  case BinaryProtocol::OP_PIXEL_DELTA:
+    if (!queueBinary(client, Command::BINARY, 0, data, len)) {
+      // Dropped batches are acknowledged right away so the sender can send them again
+      if (len >= BinaryProtocol::DELTA_HEADER_SIZE) {
+        sendDeltaAck(client, BinaryProtocol::readU16(data + 2), BinaryProtocol::DELTA_DROPPED);
+      }
+      return false;
+    }
+    return true;
+  case BinaryProtocol::OP_STREAM_FRAME:
+    return frameStream->begin(len) && frameStream->feed(data, len);
+  default:
+    Serial.printf("Unknown binary opcode: 0x%02X\n", data[0]);
+    return false;
+  }
 }
 
 // ============================================================================
-// MULTI-PACKET HANDLER
+// MULTI-PACKET HANDLERS
 // ============================================================================
 
-bool handleMultiPacket(AwsFrameInfo* info, uint8_t* data, size_t len)
+// Collects a small binary message split over several chunks of one frame
+bool handleSmallBinaryChunk(
+    AsyncWebSocketClient* client, AwsFrameInfo* info, uint8_t* data, size_t len)
+{
+  if (!smallBinaryActive || info->index != smallBinaryLength
+      || smallBinaryLength + len > sizeof(smallBinaryData)) {
+    smallBinaryActive = false;
+    return false;
+  }
+
+  memcpy(smallBinaryData + smallBinaryLength, data, len);
+  smallBinaryLength += len;
+
+  if (smallBinaryLength == info->len) {
+    smallBinaryActive = false;
+    return handleBinaryMessage(client, smallBinaryData, smallBinaryLength);
+  }
+
+  return true;
+}
+
+// Binary messages are consumed chunk by chunk, whatever their size. Blit chunks are queued as
+// they arrive and decoded by the render task, stream frames go into the jitter buffer (and have
+// to arrive as a single WebSocket frame).
+bool handleBinaryStream(
+    AsyncWebSocketClient* client, AwsFrameInfo* info, uint8_t* data, size_t len)
+{
+  uint8_t flags = 0;
+
+  // First chunk of the first frame starts a new message
+  if (info->index == 0 && info->opcode != WS_CONTINUATION) {
+    smallBinaryActive = false;
+    blitStreamActive = false;
+    frameStreamActive = false;
+
+    if (len > 0 && data[0] == BinaryProtocol::OP_PIXEL_DELTA && info->final
+        && info->len <= sizeof(smallBinaryData)) {
+      smallBinaryActive = true;
+      smallBinaryLength = 0;
+    } else if (len > 0 && data[0] == BinaryProtocol::OP_STREAM_FRAME) {
+      frameStreamActive = info->final && frameStream->begin(info->len);
+    } else if (len == 0 || data[0] != BinaryProtocol::OP_BLIT_RGB565) {
+      Serial.printf("Unknown streamed binary opcode: 0x%02X\n", len ? data[0] : 0);
+      return false;
+    } else {
+      blitStreamActive = true;
+      flags |= Command::BLIT_FIRST;
+    }
+  }
+
+  if (smallBinaryActive) {
+    return handleSmallBinaryChunk(client, info, data, len);
+  }
+  if (frameStreamActive) {
+    frameStreamActive = frameStream->feed(data, len);
+    return frameStreamActive;
+  }
+
+  // The rest of a blit that lost a chunk is dropped, it would be decoded at the wrong offset
+  if (!blitStreamActive) {
+    return false;
+  }
+
+  // Last chunk of the final frame
+  if (info->final && info->index + len >= info->len) {
+    flags |= Command::BLIT_LAST;
+  }
+
+  if (!queueBinary(client, Command::BLIT_CHUNK, flags, data, len)) {
+    blitStreamActive = false;
+    return false;
+  }
+
+  return true;
+}
+
+bool handleMultiPacket(AsyncWebSocketClient* client, AwsFrameInfo* info, uint8_t* data, size_t len)
 {
-  // First chunk - validate and reset if needed
+  // First chunk - validate and allocate the buffer for exactly this message
   if (info->index == 0) {
     Serial.printf("Starting new multi-packet message: total expected %u bytes\n", info->len);
+    resetBuffer();
 
-    // Validate expected total length
-    if (info->len > socketBufferSize) {
-      Serial.printf("ERROR: Expected message size %u exceeds buffer size %d. Rejecting message.\n",
-          info->len, socketBufferSize);
-      resetBuffer();
+    if (info->len > maxTextMessageSize) {
+      Serial.printf("ERROR: Expected message size %u exceeds limit %d. Rejecting message.\n",
+          info->len, maxTextMessageSize);
       return false;
     }
 
-    // Reset buffer for new message
-    resetBuffer();
+    socketData = (char*)malloc(info->len + 1);
+    if (socketData == nullptr) {
+      Serial.printf("ERROR: Cannot allocate %u bytes for message. Free heap: %u bytes\n",
+          info->len + 1, ESP.getFreeHeap());
+      return false;
+    }
   }
 
-  // Bounds checking to prevent buffer overflow
-  if (*currSocketBufferIndex + len > socketBufferSize) {
-    Serial.printf("ERROR: WebSocket buffer overflow! Curr: %d + New: %d > Max: %d\n",
-        *currSocketBufferIndex, len, socketBufferSize);
+  // Chunks of a message that was rejected (or never started) are dropped
+  if (socketData == nullptr || info->index != (uint64_t)socketDataLength
+      || socketDataLength + len > info->len) {
     resetBuffer();
     return false;
   }
 
-  // Copy data to buffer
-  memcpy(socketData + *currSocketBufferIndex, data, len);
-  *currSocketBufferIndex += len;
+  memcpy(socketData + socketDataLength, data, len);
+  socketDataLength += len;
 
-  Serial.printf("Multi packet data: received %d/%u bytes (%.1f%%)\n", *currSocketBufferIndex,
-      info->len, (*currSocketBufferIndex * 100.0) / info->len);
+  Serial.printf("Multi packet data: received %d/%u bytes (%.1f%%)\n", socketDataLength,
+      info->len, (socketDataLength * 100.0) / info->len);
 
   // Check if we've received the complete message
-  if (info->final && *currSocketBufferIndex >= info->len) {
-    Serial.printf("Complete message received: %d bytes\n", *currSocketBufferIndex);
+  if (info->final && socketDataLength >= info->len) {
+    Serial.printf("Complete message received: %d bytes\n", socketDataLength);
+    socketData[socketDataLength] = '\0';
 
-    // Null-terminate the buffer for safety
-    if (*currSocketBufferIndex < socketBufferSize) {
-      socketData[*currSocketBufferIndex] = '\0';
-    }
-
-    JsonDocument doc;
+    JsonDocument* doc = new JsonDocument();
 
-    DeserializationError error = deserializeJson(doc, socketData, *currSocketBufferIndex);
+    DeserializationError error = deserializeJson(*doc, socketData, socketDataLength);
     if (error) {
       Serial.printf("deserializeJson for large message failed: %s (size: %d bytes)\n",
-          error.c_str(), *currSocketBufferIndex);
+          error.c_str(), socketDataLength);
       Serial.printf("Free heap: %u bytes\n", ESP.getFreeHeap());
+      delete doc;
       resetBuffer();
       return false;
     }
 
-    const char* action = doc["action"];
-    dispatchAction(action, doc);
-
-    // Reset buffer after processing
+    // The document holds its own copy of the strings, so the text can go before dispatching
     resetBuffer();
-    Serial.println("Multi-packet message processed successfully");
-    return true;
+
+    return queueJson(client, doc);
   } else if (!info->final) {
     // More packets expected
     Serial.println("Waiting for more packets...");
@@ -489,25 +1151,50 @@ bool handleMultiPacket(AwsFrameInfo* info, uint8_t* data, size_t len)
 // MAIN MESSAGE HANDLER
 // ============================================================================
 
-void handleMessage(void* arg, uint8_t* data, size_t len)
+void handleMessage(AsyncWebSocketClient* client, void* arg, uint8_t* data, size_t len)
 {
   AwsFrameInfo* info = (AwsFrameInfo*)arg;
 
-  // Validate frame info to detect corruption
-  if (info->len > socketBufferSize || info->len == 0) {
-    Serial.printf("ERROR: Invalid frame length: %u bytes (max: %d). Corrupted frame detected.\n",
-        info->len, socketBufferSize);
+  if (info->len == 0) {
+    Serial.println("ERROR: Empty frame");
     resetBuffer();
     return;
   }
 
+  // The render task already applies an overdue scene, this closes its batch for good
+  if (commandQueue.isBatchExpired()) {
+    Serial.printf("Image for the scene from client #%u timed out\n", sceneClientId);
+    endScene();
+  }
+
+  const bool singlePacket = info->final && info->index == 0 && info->len == len;
+  const bool sceneClient = commandQueue.isBatchOpen() && client->id() == sceneClientId;
+
+  // A scene's image has to be the next message from its client
+  if (sceneClient && info->message_opcode == WS_TEXT) {
+    endScene();
+  }
+
   // Single packet message
-  if (info->final && info->index == 0 && info->len == len && info->opcode == WS_TEXT) {
-    handleSinglePacket(data, len);
+  if (singlePacket && info->opcode == WS_TEXT) {
+    handleSinglePacket(client, data, len);
+  } else if (singlePacket && info->opcode == WS_BINARY) {
+    handleBinaryMessage(client, data, len);
   }
   // Multi-packet message
-  else {
-    handleMultiPacket(info, data, len);
+  else if (info->message_opcode == WS_BINARY) {
+    handleBinaryStream(client, info, data, len);
+  } else {
+    handleMultiPacket(client, info, data, len);
+  }
+
+  // Only the image itself closes the batch, pixel deltas the client sends meanwhile go into it
+  // and stream frames bypass the queue. A blit that fails to queue has already ended the scene.
+  const bool lastChunk = info->final && info->index + len >= info->len;
+  const bool blit
+      = singlePacket ? data[0] == BinaryProtocol::OP_BLIT_RGB565 : blitStreamActive;
+  if (sceneClient && info->message_opcode == WS_BINARY && lastChunk && blit) {
+    endScene();
   }
 } // end handleMessage
 
@@ -520,12 +1207,17 @@ void onConnect(AsyncWebSocketClient* client)
   Serial.printf("WebSocket client #%u connected from %s\n", client->id(),
       client->remoteIP().toString().c_str());
   resetBuffer();
+  Outbox::addClient(client);
 }
 
 void onDisconnect(AsyncWebSocketClient* client)
 {
   Serial.printf("WebSocket client #%u disconnected\n", client->id());
   resetBuffer();
+  Outbox::removeClient(client);
+  if (client->id() == sceneClientId) {
+    endScene();
+  }
 }
 
 void onError(AsyncWebSocketClient* client)
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "../types/CommonTypes.h"
+#include "CommandQueue.h"
+#include "FrameStream.h"
 #include <Arduino.h>
 #include <ArduinoJson.h>
 #include <ESPAsyncWebServer.h>
@@ -8,26 +10,35 @@
 // Forward declarations
 class MatrixController;
 class TextDisplayHandler;
+class TextItemPool;
 class CustomDataHandler;
 
 namespace WebSocketHandler {
 
-// Initialize the WebSocket handler with required dependencies
-void init(MatrixController* matrixCtrl, TextItem* textItems, AsyncWebSocket* websocket,
-    char* socketBuffer, int* bufferIndex, const int bufferSize,
-    TextDisplayHandler* textDisplayHandler, CustomDataHandler* customDataHandler);
+// Initialize the WebSocket handler with required dependencies. JSON messages up to maxTextSize
+// bytes are accepted; binary messages are streamed and have no size limit.
+void init(MatrixController* matrixCtrl, TextItemPool* textItemPool, AsyncWebSocket* websocket,
+    const int maxTextSize, TextDisplayHandler* textDisplayHandler,
+    CustomDataHandler* customDataHandler);
 
-// Main WebSocket message handler
-void handleMessage(void* arg, uint8_t* data, size_t len);
+// Main WebSocket message handler, client is the sender (replies like delta acks go to it only).
+// Messages are decoded and queued; nothing changes until the next applyCommands().
+void handleMessage(AsyncWebSocketClient* client, void* arg, uint8_t* data, size_t len);
+
+// Applies the queued messages. Called by the render task at the start of every frame.
+// Also presents the stream frame that is due, if a stream is running.
+void applyCommands();
+CommandQueue::Stats getCommandQueueStats();
+FrameStream::Stats getFrameStreamStats();
 
 // Event handlers
 void onConnect(AsyncWebSocketClient* client);
 void onDisconnect(AsyncWebSocketClient* client);
 void onError(AsyncWebSocketClient* client);
 
-// Utility functions
-void sendPixels();
-void sendState();
+// Send to a single client, or to all of them when client is nullptr
+void sendPixels(AsyncWebSocketClient* client);
+void sendState(AsyncWebSocketClient* client);
 void broadcastConfigUpdate(); // Notify all clients of config changes
 
 } // namespace WebSocketHandler
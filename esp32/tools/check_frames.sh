@@ -0,0 +1,26 @@
+#!/bin/bash
+# Builds the simulator, checks the blend kernels and compares every scene with its golden frame
+# in sim/golden. With --record the current frames become the golden ones instead; commit them
+# together with the change that made them differ.
+
+set -e
+cd "$(dirname "$0")/.."
+
+GOLDEN_DIR="sim/golden"
+PROGRAM=".pio/build/native/program"
+
+pio run -e native
+"$PROGRAM" --check-kernels
+
+if [ "$1" == "--record" ]; then
+  "$PROGRAM" --out "$GOLDEN_DIR"
+  echo "Golden frames written to $GOLDEN_DIR, commit them with the change that caused them"
+  exit 0
+fi
+
+if ! ls "$GOLDEN_DIR"/*.ppm > /dev/null 2>&1; then
+  echo "No golden frames in $GOLDEN_DIR, record them with $0 --record"
+  exit 1
+fi
+
+"$PROGRAM" --golden "$GOLDEN_DIR"
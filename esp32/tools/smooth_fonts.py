@@ -0,0 +1,186 @@
+"""Generates src/matrix/SmoothFontData.h, the anti-aliased glyph tables used by SmoothText.
+
+The browser's fonts (browser/src/assets/fonts) are the same 1 bit fonts the firmware prints with.
+Each glyph is enlarged with Scale2x three times, which rounds off the stair steps of diagonals
+and curves, and then box filtered down to the table scale. What remains is a 4 bit coverage per
+pixel that the firmware only has to look up and blend.
+
+Runs before every PlatformIO build (extra_scripts) and only rewrites the header when the fonts
+changed. Can also be run by hand: python tools/smooth_fonts.py
+"""
+
+import os
+import re
+
+# Tables are generated for this text size only, other sizes keep the 1 bit fonts
+SCALE = 2
+# Scale2x passes, the glyph is rasterized at 2^PASSES before it is filtered down to SCALE
+PASSES = 3
+FIRST_CHAR = 0x20
+LAST_CHAR = 0x7E
+
+
+def numbers(source, name):
+    """The numbers of the array literal exported as name"""
+    match = re.search(r"export const " + name + r"\s*=\s*\[(.*?)\];", source, re.S)
+    if match is None:
+        raise ValueError("no array " + name)
+    body = re.sub(r"//[^\n]*", "", match.group(1))
+    return [int(n, 0) for n in re.findall(r"-?0x[0-9a-fA-F]+|-?\d+", body)]
+
+
+def regular_glyphs(path):
+    """glcdfont: 5 column bytes per character, bit 0 is the top row"""
+    with open(path) as f:
+        data = numbers(f.read(), "fontRegular")
+
+    glyphs = {}
+    for c in range(FIRST_CHAR, LAST_CHAR + 1):
+        columns = data[c * 5 : c * 5 + 5]
+        rows = [[(columns[x] >> y) & 1 for x in range(5)] for y in range(8)]
+        # width, height, xAdvance, xOffset, yOffset, as GFX places the built-in font
+        glyphs[c] = (rows, 5, 8, 6, 0, 0)
+    return glyphs
+
+
+def pico_glyphs(path):
+    """GFXfont: bitmaps packed MSB first without row padding, glyphs as in GFXglyph"""
+    with open(path) as f:
+        source = f.read()
+    bitmaps = numbers(source, "bitmaps")
+    glyph_data = numbers(source, "glyphs")
+    first, last, _ = numbers(source, "metaData")
+
+    glyphs = {}
+    for c in range(max(first, FIRST_CHAR), min(last, LAST_CHAR) + 1):
+        offset, width, height, advance, x_offset, y_offset = glyph_data[
+            (c - first) * 6 : (c - first) * 6 + 6
+        ]
+        bit = offset * 8
+        rows = []
+        for _ in range(height):
+            row = []
+            for _ in range(width):
+                row.append((bitmaps[bit >> 3] >> (7 - (bit & 7))) & 1)
+                bit += 1
+            rows.append(row)
+        glyphs[c] = (rows, width, height, advance, x_offset, y_offset)
+    return glyphs
+
+
+def scale2x(rows):
+    """One Scale2x (EPX) pass, pixels outside the glyph box count as unset"""
+    height = len(rows)
+    width = len(rows[0]) if height else 0
+
+    def at(x, y):
+        return rows[y][x] if 0 <= x < width and 0 <= y < height else 0
+
+    out = [[0] * (width * 2) for _ in range(height * 2)]
+    for y in range(height):
+        for x in range(width):
+            p = rows[y][x]
+            a, b, c, d = at(x, y - 1), at(x + 1, y), at(x - 1, y), at(x, y + 1)
+            out[y * 2][x * 2] = a if c == a and c != d and a != b else p
+            out[y * 2][x * 2 + 1] = b if a == b and a != c and b != d else p
+            out[y * 2 + 1][x * 2] = c if d == c and d != b and c != a else p
+            out[y * 2 + 1][x * 2 + 1] = d if b == d and b != a and d != c else p
+    return out
+
+
+def coverage(rows, width, height):
+    """4 bit coverage of each pixel of the glyph at SCALE"""
+    for _ in range(PASSES):
+        rows = scale2x(rows)
+    block = (1 << PASSES) // SCALE
+    area = block * block
+
+    result = []
+    for y in range(height * SCALE):
+        row = []
+        for x in range(width * SCALE):
+            covered = sum(
+                rows[y * block + dy][x * block + dx] for dy in range(block) for dx in range(block)
+            )
+            row.append((covered * 15 + area // 2) // area)
+        result.append(row)
+    return result
+
+
+def font_table(name, glyphs):
+    """C++ source for one SmoothFont"""
+    alpha = []
+    entries = []
+    for c in range(FIRST_CHAR, LAST_CHAR + 1):
+        rows, width, height, advance, x_offset, y_offset = glyphs[c]
+        offset = len(alpha)
+        # Two pixels per byte, high nibble first, every row starts on a new byte
+        for row in coverage(rows, width, height):
+            row = row + [0] * (len(row) & 1)
+            alpha.extend((row[i] << 4) | row[i + 1] for i in range(0, len(row), 2))
+        entries.append(
+            "  { %d, %d, %d, %d, %d, %d }, // 0x%02X %s"
+            % (
+                offset,
+                width * SCALE,
+                height * SCALE,
+                advance * SCALE,
+                x_offset * SCALE,
+                y_offset * SCALE,
+                c,
+                repr(chr(c)),
+            )
+        )
+
+    lines = ["constexpr uint8_t %sAlpha[] = {" % name]
+    for i in range(0, len(alpha), 16):
+        lines.append("  " + ", ".join("0x%02X" % v for v in alpha[i : i + 16]) + ",")
+    lines.append("};")
+    lines.append("")
+    lines.append("constexpr SmoothGlyph %sGlyphs[] = {" % name)
+    lines.extend(entries)
+    lines.append("};")
+    lines.append("")
+    lines.append(
+        "constexpr SmoothFont %s = { %sAlpha, %sGlyphs, 0x%02X, 0x%02X, %d };"
+        % (name, name, name, FIRST_CHAR, LAST_CHAR, SCALE)
+    )
+    return "\n".join(lines)
+
+
+def generate(project_dir):
+    fonts_dir = os.path.join(project_dir, "..", "browser", "src", "assets", "fonts")
+    target = os.path.join(project_dir, "src", "matrix", "SmoothFontData.h")
+
+    header = "\n".join(
+        [
+            "// Generated by tools/smooth_fonts.py from browser/src/assets/fonts, do not edit",
+            "#pragma once",
+            "",
+            '#include "SmoothText.h"',
+            "",
+            "namespace SmoothFontData {",
+            "",
+            font_table("regular", regular_glyphs(os.path.join(fonts_dir, "regular.ts"))),
+            "",
+            font_table("pico", pico_glyphs(os.path.join(fonts_dir, "pico.ts"))),
+            "",
+            "} // namespace SmoothFontData",
+            "",
+        ]
+    )
+
+    if os.path.exists(target):
+        with open(target) as f:
+            if f.read() == header:
+                return
+    with open(target, "w") as f:
+        f.write(header)
+    print("Generated " + os.path.relpath(target, project_dir))
+
+
+if "Import" in globals():
+    Import("env")  # noqa: F821, provided by PlatformIO
+    generate(env.subst("$PROJECT_DIR"))  # noqa: F821
+elif __name__ == "__main__":
+    generate(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))